@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * ============================================================================
+ *  MacroMorphFX — Module Chain Order
+ * ============================================================================
+ *
+ *  The four modules (Filter, Drive, Delay, Reverb) can run in any of the
+ *  4! = 24 orders.  The orders are a compile-time table in lexicographic
+ *  order, so index 0 is the original chain (Filter → Drive → Delay →
+ *  Reverb) and the global param chainOrder is an index into it.
+ *
+ *  The processor instantiates one chain function per entry (template over
+ *  the four stages), so picking an order is one table lookup per control
+ *  block: no virtual calls, and no branching on the order inside the chain.
+ *
+ *  Lane D — Scenes/Morph/Macros
+ * ============================================================================
+ */
+
+#include <array>
+#include <cstddef>
+#include <juce_core/juce_core.h>
+
+// ─── Chain stages ──────────────────────────────────────────────────────────
+namespace ChainStage
+{
+    enum Index
+    {
+        filter = 0,
+        drive,
+        delay,
+        reverb,
+        kCount
+    };
+
+    /** Short names for the chainOrder choice labels (order matches Index). */
+    static constexpr const char* shortNames[kCount] = { "Flt", "Drv", "Dly", "Rev" };
+}
+
+static constexpr int kNumChainOrders = 24;   // 4!
+
+using ChainOrder = std::array<int, ChainStage::kCount>;
+
+/** All stage orders, lexicographic (index 0 = Filter, Drive, Delay, Reverb). */
+static constexpr std::array<ChainOrder, kNumChainOrders> makeChainOrders()
+{
+    std::array<ChainOrder, kNumChainOrders> orders {};
+    ChainOrder order { ChainStage::filter, ChainStage::drive, ChainStage::delay, ChainStage::reverb };
+
+    for (auto& entry : orders)
+    {
+        entry = order;
+
+        // Next permutation (no std::next_permutation in constexpr before C++20)
+        int i = ChainStage::kCount - 2;
+        while (i >= 0 && order[static_cast<size_t> (i)] >= order[static_cast<size_t> (i + 1)])
+            --i;
+
+        if (i < 0)
+            break;
+
+        int j = ChainStage::kCount - 1;
+        while (order[static_cast<size_t> (j)] <= order[static_cast<size_t> (i)])
+            --j;
+
+        const int tmp = order[static_cast<size_t> (i)];
+        order[static_cast<size_t> (i)] = order[static_cast<size_t> (j)];
+        order[static_cast<size_t> (j)] = tmp;
+
+        for (int a = i + 1, b = ChainStage::kCount - 1; a < b; ++a, --b)
+        {
+            const int t = order[static_cast<size_t> (a)];
+            order[static_cast<size_t> (a)] = order[static_cast<size_t> (b)];
+            order[static_cast<size_t> (b)] = t;
+        }
+    }
+
+    return orders;
+}
+
+static constexpr std::array<ChainOrder, kNumChainOrders> kChainOrders = makeChainOrders();
+
+static_assert (kChainOrders[0][0] == ChainStage::filter && kChainOrders[0][3] == ChainStage::reverb);
+static_assert (kChainOrders[kNumChainOrders - 1][0] == ChainStage::reverb
+            && kChainOrders[kNumChainOrders - 1][3] == ChainStage::filter);
+
+/** Choice labels, e.g. "Flt > Drv > Dly > Rev" (index matches kChainOrders). */
+inline juce::StringArray getChainOrderLabels()
+{
+    juce::StringArray labels;
+
+    for (const auto& order : kChainOrders)
+    {
+        juce::StringArray names;
+        for (int stage : order)
+            names.add (ChainStage::shortNames[stage]);
+
+        labels.add (names.joinIntoString (" > "));
+    }
+
+    return labels;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ *  AudioArena — One cache-line-aligned block for an instance's audio memory
+ *
+ *  Delay lines, pre-delay rings, diffuser slots, crossfade scratch, the dry
+ *  buffer and the quantum FIFO all come from a single allocation, laid out
+ *  in processing order.  prepareToPlay runs the same assignment code twice:
+ *
+ *      arena.beginLayout();   assignBuffers (arena);   // counts sizes, returns nullptr
+ *      arena.commit();        assignBuffers (arena);   // hands out real pointers
+ *
+ *  commit() only reallocates when the layout grew, so re-preparing with an
+ *  unchanged (or smaller) sample rate / block size reuses the block.  It
+ *  zero-fills everything handed out, which doubles as the buffers' reset.
+ *  Every allocation starts on a 64-byte boundary.
+ *
+ *  Rate-dependent buffers (delay lines, pre-delay, diffuser) are laid out
+ *  for kMaxSampleRate (or the actual rate, if higher), so a later
+ *  sample-rate change with the same channel count and block size keeps the
+ *  block and its pointers: modules only re-derive their lengths
+ *  (changeSampleRate) and nothing is reallocated.
+ *
+ *  Only trivially copyable element types (float, SIMDRegister) — nothing is
+ *  constructed or destroyed.
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+class AudioArena
+{
+public:
+    static constexpr size_t kAlignment   = 64;   // bytes (cache line)
+    static constexpr double kMaxSampleRate = 192000.0;   // rate-dependent buffers are sized for this
+
+    /** Rate to size rate-dependent buffers for when preparing at `sampleRate`. */
+    static constexpr double capacityRate (double sampleRate) noexcept
+    {
+        return sampleRate > kMaxSampleRate ? sampleRate : kMaxSampleRate;
+    }
+
+    AudioArena() = default;
+
+    /** Start a layout pass: allocate() counts bytes and returns nullptr until commit(). */
+    void beginLayout() noexcept
+    {
+        layingOut_   = true;
+        layoutBytes_ = 0;
+        used_        = 0;
+    }
+
+    /**
+     *  Back the counted layout with memory (reusing the current block if it
+     *  is big enough), zero it and start handing out pointers from the top.
+     *  @returns true if a new block was allocated
+     */
+    bool commit()
+    {
+        layingOut_ = false;
+        used_      = 0;
+
+        bool reallocated = false;
+
+        if (layoutBytes_ > capacity_)
+        {
+            storage_.reset (new char[layoutBytes_ + kAlignment]);
+            const auto addr = reinterpret_cast<std::uintptr_t> (storage_.get());
+            base_     = storage_.get() + (kAlignment - addr % kAlignment) % kAlignment;
+            capacity_ = layoutBytes_;
+            reallocated = true;
+        }
+
+        if (layoutBytes_ > 0)
+            std::memset (base_, 0, layoutBytes_);
+
+        return reallocated;
+    }
+
+    bool isLayingOut() const noexcept       { return layingOut_; }
+    size_t getCapacityBytes() const noexcept { return capacity_; }
+
+    /** `count` elements on a cache-line boundary (nullptr during layout). */
+    template <typename T>
+    T* allocate (size_t count) noexcept
+    {
+        static_assert (std::is_trivially_copyable_v<T>, "AudioArena holds plain data only");
+        static_assert (alignof (T) <= kAlignment);
+
+        const size_t bytes = (count * sizeof (T) + kAlignment - 1) / kAlignment * kAlignment;
+
+        if (layingOut_)
+        {
+            layoutBytes_ += bytes;
+            return nullptr;
+        }
+
+        jassert (used_ + bytes <= layoutBytes_);   // assignment differs from the layout pass
+        auto* p = reinterpret_cast<T*> (base_ + used_);
+        used_ += bytes;
+        return p;
+    }
+
+    /** Point `buffer` at numChannels × numSamples floats from the arena
+        (untouched during layout).  Any channel count: the pointer array is
+        sized from it, and the buffer copies it. */
+    void assign (juce::AudioBuffer<float>& buffer, int numChannels, int numSamples)
+    {
+        std::vector<float*> channels (static_cast<size_t> (std::max (numChannels, 0)));
+        for (auto& channel : channels)
+            channel = allocate<float> (static_cast<size_t> (numSamples));
+
+        if (! layingOut_)
+            buffer.setDataToReferTo (channels.data(), numChannels, numSamples);
+    }
+
+private:
+    std::unique_ptr<char[]> storage_;
+    char*  base_        = nullptr;
+    size_t capacity_    = 0;
+    size_t layoutBytes_ = 0;
+    size_t used_        = 0;
+    bool   layingOut_   = false;
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+/**
+ *  CachedParam — Dirty tracking for a control value
+ *
+ *  Remembers the value a module last derived its coefficients from, so
+ *  setParameters() can skip the recomputation (std::pow, SVF tan(), Freeverb
+ *  parameter updates) while the smoothed control value holds still:
+ *
+ *      if (cutoff_.update (cutoffHz, 0.01f))
+ *          filter.setCutoffFrequency (cutoffHz);
+ *
+ *  Starts (and can be reset to) "unknown", so the first update always
+ *  reports a change.  Copy it along with the state it describes
+ *  (copyStateFrom), so a pre-warmed instance doesn't skip a real change.
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+struct CachedParam
+{
+    float value = std::numeric_limits<float>::quiet_NaN();   // NaN: nothing computed yet
+
+    /** Store `newValue` and return true if it differs from the cached one by more than `epsilon`. */
+    bool update (float newValue, float epsilon) noexcept
+    {
+        if (std::abs (newValue - value) <= epsilon)   // false while value is NaN
+            return false;
+
+        value = newValue;
+        return true;
+    }
+
+    void invalidate() noexcept   { value = std::numeric_limits<float>::quiet_NaN(); }
+};
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "AudioArena.h"
+
+/**
+ *  CrossfadeSwitch — Click-free switching of a module's discrete parameters
+ *
+ *  Discrete scene params (filter mode, drive curve, delay mode / sync /
+ *  ping-pong) change
+ *  instantly when morph crosses 0.5.  Instead of jumping, the switch holds
+ *  two instances of the module:
+ *
+ *    - Outside a transition only the live instance is processed; the
+ *      standby instance is never touched.  Its memory comes from the
+ *      processor's AudioArena in prepareToPlay (creating it on demand would
+ *      allocate on the audio thread), but only what one fade needs:
+ *      Module::assignStandbyBuffers gets the longest fade in samples, so a
+ *      module with long buffers (the delay lines) can keep just the samples
+ *      written during the fade and read older ones from the live instance.
+ *    - When the discrete "key" changes, the standby is pre-warmed from the
+ *      live instance (Module::copyStateFrom), given the new key, and both
+ *      run while the output crossfades linearly from old to new.  The
+ *      standby runs first in each fade block, so it sees the live
+ *      instance's buffers as they were at the start of the block.
+ *    - At the end of the fade the live instance takes the standby's state
+ *      (Module::takeStateFrom) and the new key; the live instance is
+ *      always the same one.
+ *
+ *  Module requirements:
+ *    void prepare (const juce::dsp::ProcessSpec&);
+ *    void assignBuffers (AudioArena&);               // audio memory, after prepare
+ *    void assignStandbyBuffers (AudioArena&, int maxFadeSamples);   // standby only
+ *    void changeSampleRate (const juce::dsp::ProcessSpec&);   // keep state, no allocation
+ *    void reset();
+ *    void copyStateFrom (const Module&, int fadeSamples);   // standby from live, no allocation
+ *    void takeStateFrom (const Module&);                    // live from standby, end of fade
+ *    void process (juce::dsp::AudioBlock<float>&);
+ *
+ *  The key is any int that identifies the discrete settings (e.g. filter
+ *  mode, drive curve, or sync * 2 + pingPong).  The caller decodes it in its setParams
+ *  callback, which is called once per process() for every running instance.
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+template <typename Module>
+class CrossfadeSwitch
+{
+public:
+    CrossfadeSwitch() = default;
+
+    void prepare (const juce::dsp::ProcessSpec& spec, double fadeSeconds = 0.02)
+    {
+        for (auto& m : modules_)
+            m.prepare (spec);
+
+        sampleRate_   = spec.sampleRate;
+        numChannels_  = static_cast<int> (spec.numChannels);
+        maxBlockSize_ = static_cast<int> (spec.maximumBlockSize);
+
+        fadeSeconds_ = fadeSeconds;
+        fadeLength_  = std::max (1, static_cast<int> (spec.sampleRate * fadeSeconds));
+        fadePos_     = fadeLength_;   // not fading
+        hasKey_      = false;
+    }
+
+    /**
+     *  The live instance's memory, the standby's (one fade at
+     *  AudioArena::capacityRate, plus the block that overshoots its end),
+     *  then the standby scratch buffer.  Sizes from prepare().
+     */
+    void assignBuffers (AudioArena& arena)
+    {
+        const int maxFadeSamples = static_cast<int> (AudioArena::capacityRate (sampleRate_) * fadeSeconds_)
+                                 + maxBlockSize_;
+
+        modules_[0].assignBuffers (arena);
+        modules_[1].assignStandbyBuffers (arena, maxFadeSamples);
+
+        arena.assign (scratch_, numChannels_, maxBlockSize_);
+    }
+
+    /**
+     *  New sample rate with buffers already assigned.  The live instance
+     *  keeps its state (Module::changeSampleRate); the standby is just
+     *  re-prepared, since it is refilled from the live one before its next
+     *  use.  A fade in progress is dropped — if the key still differs, the
+     *  next process() starts it again from the live instance.
+     */
+    void changeSampleRate (const juce::dsp::ProcessSpec& spec, double fadeSeconds = 0.02)
+    {
+        jassert (fadeSeconds <= fadeSeconds_);   // standby memory sized in prepare()
+
+        modules_[0].changeSampleRate (spec);
+        modules_[1].prepare (spec);
+
+        fadeLength_ = std::max (1, static_cast<int> (spec.sampleRate * fadeSeconds));
+        fadePos_    = fadeLength_;
+    }
+
+    void reset()
+    {
+        for (auto& m : modules_)
+            m.reset();
+
+        fadePos_ = fadeLength_;
+        hasKey_  = false;
+    }
+
+    /** True while both instances are running. */
+    bool isFading() const noexcept { return fadePos_ < fadeLength_; }
+
+    /** The instance currently heard (or fading out). */
+    Module&       getLive() noexcept       { return modules_[0]; }
+    const Module& getLive() const noexcept { return modules_[0]; }
+
+    /**
+     *  Process one block in place.
+     *
+     *  @param block      audio to process
+     *  @param key        discrete settings for this block
+     *  @param setParams  callable (Module&, int key) that applies all params
+     */
+    template <typename SetParams>
+    void process (juce::dsp::AudioBlock<float>& block, int key, SetParams&& setParams)
+    {
+        if (! hasKey_)
+        {
+            // First block after prepare/reset: adopt the key, nothing to fade from
+            liveKey_ = key;
+            hasKey_  = true;
+        }
+        else if (key != liveKey_ && ! isFading())
+        {
+            // Start a transition (a key change during a fade waits for it to finish)
+            modules_[1].copyStateFrom (modules_[0], fadeLength_);
+            pendingKey_ = key;
+            fadePos_    = 0;
+        }
+
+        setParams (modules_[0], liveKey_);
+
+        if (! isFading())
+        {
+            modules_[0].process (block);
+            return;
+        }
+
+        // ── Transition: run both instances and crossfade ────────────────
+        auto& standby = modules_[1];
+        setParams (standby, pendingKey_);
+
+        const auto numChannels = std::min (block.getNumChannels(),
+                                           static_cast<size_t> (scratch_.getNumChannels()));
+        const auto numSamples  = block.getNumSamples();
+
+        juce::dsp::AudioBlock<float> standbyBlock (scratch_);
+        standbyBlock = standbyBlock.getSubsetChannelBlock (0, numChannels)
+                                   .getSubBlock (0, numSamples);
+        standbyBlock.copyFrom (block.getSubsetChannelBlock (0, numChannels));
+
+        standby.process (standbyBlock);
+        modules_[0].process (block);
+
+        const float step = 1.0f / static_cast<float> (fadeLength_);
+
+        for (size_t ch = 0; ch < numChannels; ++ch)
+        {
+            auto* out      = block.getChannelPointer (ch);
+            const auto* in = standbyBlock.getChannelPointer (ch);
+            float g = static_cast<float> (fadePos_) * step;
+
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                const float gain = std::min (g, 1.0f);
+                out[s] += gain * (in[s] - out[s]);
+                g += step;
+            }
+        }
+
+        fadePos_ += static_cast<int> (numSamples);
+
+        if (! isFading())
+        {
+            modules_[0].takeStateFrom (standby);
+            liveKey_ = pendingKey_;
+        }
+    }
+
+private:
+    Module modules_[2];   // [0] live, [1] standby
+
+    int  liveKey_    = 0;
+    int  pendingKey_ = 0;
+    bool hasKey_     = false;
+
+    double fadeSeconds_ = 0.02;
+    int    fadeLength_  = 1;
+    int    fadePos_     = 1;
+
+    juce::AudioBuffer<float> scratch_;   // standby input/output during a fade (arena)
+    double sampleRate_   = 44100.0;
+    int    numChannels_  = 0;
+    int    maxBlockSize_ = 0;
+};
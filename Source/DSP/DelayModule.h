@@ -2,31 +2,82 @@
 
 #include <juce_dsp/juce_dsp.h>
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "StereoDiffuser.h"
+#include "CachedParam.h"
+#include "DspTables.h"
+#include "AudioArena.h"
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 /**
- *  DelayModule — Tempo-synced stereo delay
+ *  DelayModule — Tempo-synced / free-time stereo delay
  *
  *  Params from Params.h:
+ *    delayMode      (choice 0..1)  — 0 = tempo sync, 1 = free time (ms)
  *    delaySync      (choice 0..7)  — note value for tempo sync
+ *    delayTimeMs    (1..4000)      — delay time in free mode
  *    delayFeedback  (0..0.95)      — feedback amount (hard clamped per SPEC)
  *    delayTone      (0..1)         — feedback tone (0 = dark, 1 = bright)
  *    delayWidth     (0..1)         — stereo width (0 = mono, 1 = full stereo)
  *    delayPingPong  (bool)         — ping-pong mode
+ *    delayWow       (0..1)         — slow pitch wobble depth (tape wow)
+ *    delayFlutter   (0..1)         — fast pitch wobble depth (tape flutter)
+ *    delayDrift     (0..1)         — random slow drift depth
+ *    delaySat       (0..1)         — soft saturation in the feedback path
+ *    delayDiffuse   (0..1)         — allpass diffusion in the feedback path
+ *    delayLevel     (0..1)         — wet level added to the input (parallel
+ *                                    routing; the processor passes 1 in serial)
  *
  *  Implementation:
- *    - Circular buffer delay line per channel
- *    - Tempo sync via BPM from host playhead
- *    - Smoothed delay time (50ms ramp) with fractional read (linear interpolation)
- *    - Feedback with one-pole tone filter in the loop
+ *    - Circular buffer delay line per channel, from the processor's
+ *      AudioArena (assignBuffers, after prepare), with room for
+ *      AudioArena::kMaxSampleRate.  A sample-rate change (changeSampleRate)
+ *      resamples the lines in place, so the echoes carry over
+ *    - Tempo sync locked to the musical grid: the read head sits exactly
+ *      `noteBeats` behind the current beat position (host ppq, or a
+ *      free-running position when stopped).  A short history of tempo
+ *      anchors maps beats back to samples, so echoes stay on the grid
+ *      through tempo ramps instead of drifting.
+ *    - Free mode ignores the tempo: the delay time comes straight from
+ *      delayTimeMs, so renders without a tempo map get the set time and
+ *      morphing the time between scenes glides the read head.
+ *    - Delay time ramps sample-accurately across each control block
+ *      (start → end of block) with fractional read (linear interpolation)
+ *    - Tape modulation: wow (0.9 Hz) + flutter (9 Hz) sines from rotation
+ *      recurrences (no std::sin per sample) plus smoothed random drift,
+ *      added to the fractional read position.  While any of them is active
+ *      the read uses 4-point Hermite interpolation instead of linear.
+ *    - Feedback with one-pole tone filter in the loop, optional allpass
+ *      diffusion (StereoDiffuser, blended in by the diffuse amount), then a
+ *      rational tanh soft clip (branch-free, run over the L/R pair so it
+ *      vectorizes)
+ *    - Tone cutoff (shared DspTables curve + SVF tan, both channels) is only
+ *      recomputed when delayTone moves (CachedParam)
  *    - Ping-pong: alternates feedback between L and R
  *    - Width: crossfade between mono (L=R) and stereo delay
+ *    - As CrossfadeSwitch's standby the module owns no delay lines, only a
+ *      fade-length overlay (assignStandbyBuffers).  During the fade it
+ *      writes there and reads anything older from the live instance's
+ *      lines; takeStateFrom() then writes the overlay into the live lines
  *
  *  Lane A — DSP modules (Source/DSP/*)
  */
 class DelayModule
 {
 public:
+    /** Tape section params, 0..1 each. */
+    struct TapeParams
+    {
+        float wow        = 0.0f;
+        float flutter    = 0.0f;
+        float drift      = 0.0f;
+        float saturation = 0.0f;
+        float diffuse    = 0.0f;
+    };
+
     DelayModule() = default;
 
     void prepare (const juce::dsp::ProcessSpec& spec)
@@ -34,14 +85,10 @@ public:
         sampleRate = spec.sampleRate;
         numChannels = static_cast<int> (spec.numChannels);
 
-        // Max delay: 2 seconds (covers 1 bar at 30 BPM)
-        bufSize_ = static_cast<int> (sampleRate * 2.0);
+        bufSize_ = bufferSizeFor (sampleRate);
 
         for (int ch = 0; ch < 2; ++ch)
-        {
-            delayLine[ch].resize (static_cast<size_t> (bufSize_), 0.0f);
             writePos[ch] = 0;
-        }
 
         // Feedback tone filter
         for (int ch = 0; ch < 2; ++ch)
@@ -52,37 +99,178 @@ public:
             toneLPF[ch].setResonance (0.707f);
         }
 
-        // Smooth delay time changes over 50 ms to avoid clicks
-        smoothDelay_.reset (sampleRate, 0.05);
-        smoothDelay_.setCurrentAndTargetValue (static_cast<float> (bufSize_ / 4));
+        tone_.invalidate();
+        diffuser_.prepare (sampleRate);
+
+        // Tape modulation: fixed rates, depths set per block
+        wowOsc_.setFrequency (kWowHz, sampleRate);
+        flutterOsc_.setFrequency (kFlutterHz, sampleRate);
+        driftInterval_ = std::max (1, static_cast<int> (sampleRate / kDriftStepsPerSecond));
+        driftCoeff_    = static_cast<float> (1.0 - std::exp (-2.0 * juce::MathConstants<double>::pi
+                                                             * kDriftSmoothHz / sampleRate));
+        resetModulation();
+
+        // Tempo anchor history (beats → samples)
+        anchors_.resize (kMaxAnchors);
+        resetTimeline();
+        overlaySource_ = nullptr;
+    }
+
+    /** Take the delay lines and diffuser memory from the arena (room for AudioArena::capacityRate). */
+    void assignBuffers (AudioArena& arena)
+    {
+        bufCapacity_ = bufferSizeFor (AudioArena::capacityRate (sampleRate));
+
+        for (int ch = 0; ch < 2; ++ch)
+            delayLine[ch] = arena.allocate<float> (static_cast<size_t> (bufCapacity_));
+
+        diffuser_.assignBuffers (arena);
+    }
+
+    /**
+     *  CrossfadeSwitch standby: no delay lines, just an overlay for the
+     *  samples written during one fade (`maxFadeSamples`, at
+     *  AudioArena::capacityRate) and the diffuser.
+     */
+    void assignStandbyBuffers (AudioArena& arena, int maxFadeSamples)
+    {
+        overlayCapacity_ = maxFadeSamples;
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            delayLine[ch] = nullptr;
+            overlay_[ch]  = arena.allocate<float> (static_cast<size_t> (overlayCapacity_));
+        }
+
+        diffuser_.assignBuffers (arena);
+    }
+
+    /**
+     *  New sample rate, buffers already assigned (no allocation).  Re-derives
+     *  everything prepare() does, then resamples each delay line to the new
+     *  length so the echoes in flight keep their timing.  The diffuser's
+     *  short allpass memory is cleared.
+     */
+    void changeSampleRate (const juce::dsp::ProcessSpec& spec)
+    {
+        jassert (bufferSizeFor (spec.sampleRate) <= bufCapacity_);
+
+        const int oldSize = bufSize_;
+        const int oldWritePos[2] = { writePos[0], writePos[1] };
+
+        prepare (spec);   // new bufSize_, write positions back to 0
+        diffuser_.reset();
+
+        for (int ch = 0; ch < 2; ++ch)
+            resampleLine (delayLine[ch], oldSize, oldWritePos[ch], bufSize_);
     }
 
     void reset()
     {
         for (int ch = 0; ch < 2; ++ch)
         {
-            std::fill (delayLine[ch].begin(), delayLine[ch].end(), 0.0f);
+            if (delayLine[ch] != nullptr)   // a standby has none
+                std::fill (delayLine[ch], delayLine[ch] + bufSize_, 0.0f);
+
             writePos[ch] = 0;
             toneLPF[ch].reset();
         }
+
+        diffuser_.reset();
+        resetModulation();
+        resetTimeline();
+        overlaySource_ = nullptr;
+    }
+
+    /**
+     *  Pre-warm a standby from the live instance (crossfade switching).
+     *  Copies the filter state, tape modulation and tempo history without
+     *  allocating; the first block after the copy jumps straight to its own
+     *  delay time instead of ramping, since the crossfade hides the change.
+     *
+     *  Nothing of the delay lines is copied: until takeStateFrom(), this
+     *  instance writes into its overlay and reads older samples straight
+     *  from `other`'s lines.  `other` keeps writing only samples newer than
+     *  the copy, which this instance reads from the overlay, so the two
+     *  never interfere.  The overlay must hold the fade (assignStandbyBuffers).
+     */
+    void copyStateFrom (const DelayModule& other, int fadeSamples)
+    {
+        jassert (overlay_[0] != nullptr && fadeSamples <= overlayCapacity_);
+        juce::ignoreUnused (fadeSamples);
+
+        copyRunningState (other);
+        delayValid_ = false;
+
+        overlaySource_   = &other;
+        overlayCount_    = 0;
+        overlayChannels_ = 0;
+    }
+
+    /**
+     *  End of a crossfade: the live instance takes over the standby's
+     *  state.  The standby's overlay replaces this instance's own writes
+     *  since the copy (the last overlayCount_ samples of each line), so the
+     *  lines hold exactly what the standby heard: history from before the
+     *  fade, its own feedback after.
+     */
+    void takeStateFrom (const DelayModule& standby)
+    {
+        jassert (standby.overlaySource_ == this && standby.samplePos_ == samplePos_);
+
+        const int count = standby.overlayCount_;
+
+        for (int ch = 0; ch < standby.overlayChannels_; ++ch)
+        {
+            int start = writePos[ch] - count;
+            if (start < 0)
+                start += bufSize_;
+
+            const int first = std::min (count, bufSize_ - start);
+            std::copy (standby.overlay_[ch], standby.overlay_[ch] + first, delayLine[ch] + start);
+            std::copy (standby.overlay_[ch] + first, standby.overlay_[ch] + count, delayLine[ch]);
+        }
+
+        copyRunningState (standby);
+        currentDelay_ = standby.currentDelay_;
+        delayValid_   = standby.delayValid_;
     }
 
     /**
+     *  @param freeTime    true = free time (from Params::ID::delayMode)
      *  @param syncIndex   0..7 note value index (from Params::ID::delaySync)
+     *  @param timeMs      1..4000 free delay time (from Params::ID::delayTime)
      *  @param feedback    0..0.95 (from Params::ID::delayFb)
      *  @param tone01      0..1 (from Params::ID::delayTone)
      *  @param width01     0..1 (from Params::ID::delayWidth)
      *  @param pingPong    true/false (from Params::ID::delayPingP)
-     *  @param bpm         current host BPM (from playhead)
+     *  @param tape        wow / flutter / drift / saturation / diffuse, 0..1 each
+     *                     (from Params::ID::delayWow .. delayDiffuse)
+     *  @param ppq         beat position at the first sample of the next process() call
+     *  @param bpm         current tempo (from the cached transport snapshot)
      */
-    void setParameters (int syncIndex, float feedback, float tone01,
-                        float width01, bool pingPong, double bpm)
+    void setParameters (bool freeTime, int syncIndex, float timeMs, float feedback, float tone01,
+                        float width01, bool pingPong, const TapeParams& tape, double ppq, double bpm)
     {
         // Clamp feedback per SPEC safety cap
         fb = std::min (feedback, 0.95f);
         width = width01;
         isPingPong = pingPong;
 
+        // Tape modulation depths in samples (ramped across the next block)
+        const double msToSamples = 0.001 * sampleRate;
+        modDepthTarget_[wow]     = static_cast<float> (std::clamp (tape.wow,     0.0f, 1.0f) * kWowMaxMs     * msToSamples);
+        modDepthTarget_[flutter] = static_cast<float> (std::clamp (tape.flutter, 0.0f, 1.0f) * kFlutterMaxMs * msToSamples);
+        modDepthTarget_[drift]   = static_cast<float> (std::clamp (tape.drift,   0.0f, 1.0f) * kDriftMaxMs   * msToSamples);
+        satAmount_ = std::clamp (tape.saturation, 0.0f, 1.0f);
+
+        // The diffuser isn't clocked while diffuse is 0: start it from
+        // silence when it comes back, not from what it held back then
+        const float diffuse = std::clamp (tape.diffuse, 0.0f, 1.0f);
+        if (diffuseAmount_ == 0.0f && diffuse > 0.0f)
+            diffuser_.reset();
+        diffuseAmount_ = diffuse;
+
         // Sync index to note duration in beats:
         //   0=1/32, 1=1/16, 2=1/8, 3=1/4, 4=1/2, 5=1bar, 6=1/8dot, 7=1/4dot
         static constexpr float noteBeats[] = {
@@ -97,31 +285,184 @@ public:
         };
 
         int idx = std::clamp (syncIndex, 0, 7);
-        float beats = noteBeats[idx];
+        delayBeats_ = noteBeats[idx];
 
-        // Convert beats to samples: samples = beats * (60 / bpm) * sampleRate
-        double safeBpm = (bpm > 20.0) ? bpm : 120.0;  // fallback if host doesn't report BPM
-        float newDelay = static_cast<float> (beats * (60.0 / safeBpm) * sampleRate);
+        // Free time: target for the end of the next block (smoothed upstream,
+        // so a morphed time ramps block to block)
+        isFreeTime_ = freeTime;
+        freeDelaySamples_ = std::clamp (static_cast<double> (timeMs) * 0.001 * sampleRate,
+                                        1.0, static_cast<double> (bufSize_ - 2));
 
-        // Clamp to buffer size
-        newDelay = std::clamp (newDelay, 1.0f, static_cast<float> (bufSize_ - 1));
-        smoothDelay_.setTargetValue (newDelay);
+        // Musical timeline for this block (anchors only added on tempo change / jump).
+        // Kept up to date in free mode too, so switching back to sync lands on the grid.
+        const double safeBpm = (bpm > 20.0) ? bpm : 120.0;
+        blockPpq_ = ppq;
+        blockBeatsPerSample_ = safeBpm / (60.0 * sampleRate);
+        addAnchor (blockPpq_, blockBeatsPerSample_);
 
         // Tone filter: 0 = dark (500 Hz), 1 = bright (20000 Hz)
-        float toneCutoff = 500.0f * std::pow (40.0f, tone01);
+        if (tone_.update (tone01, kToneEpsilon))
+        {
+            const float toneCutoff = tables_->delayToneHz (tone01);
+            for (int ch = 0; ch < 2; ++ch)
+                toneLPF[ch].setCutoffFrequency (toneCutoff);
+        }
+    }
+
+    /** Wet level added to the input, 0..1 (from Params::ID::delayLevel). */
+    void setWetLevel (float level01) noexcept   { wetLevel_ = std::clamp (level01, 0.0f, 1.0f); }
+
+    void process (juce::dsp::AudioBlock<float>& block)
+    {
+        const int numSamples = static_cast<int> (block.getNumSamples());
+
+        // Delay length at the start and end of this block, from the beat grid
+        // (or the free time); ramped linearly per sample in between (shared
+        // by both channels)
+        if (! delayValid_)
+        {
+            currentDelay_ = isFreeTime_ ? freeDelaySamples_
+                                        : gridDelaySamples (samplePos_, blockPpq_);
+            delayValid_   = true;
+        }
+
+        const double endDelay = isFreeTime_ ? freeDelaySamples_
+                                            : gridDelaySamples (samplePos_ + numSamples,
+                                                                blockPpq_ + numSamples * blockBeatsPerSample_);
+
+        const float diffuseGain = kMaxDiffusion * diffuseAmount_;
+
+        // Linear read is enough for plain time ramps; modulation (and its
+        // fade-out) uses the Hermite read
+        bool modulated = false;
+        for (int m = 0; m < kNumModSources; ++m)
+            modulated = modulated || modDepth_[m] > 0.0f || modDepthTarget_[m] > 0.0f;
+
+        // A standby in a crossfade reads through its overlay
+        if (overlaySource_ != nullptr)
+        {
+            jassert (overlayCount_ + numSamples <= overlayCapacity_);
+
+            if (modulated) processSamples<true, true>   (block, endDelay, diffuseGain);
+            else           processSamples<false, true>  (block, endDelay, diffuseGain);
+
+            overlayCount_   += numSamples;
+            overlayChannels_ = std::min (static_cast<int> (block.getNumChannels()), 2);
+        }
+        else
+        {
+            if (modulated) processSamples<true, false>  (block, endDelay, diffuseGain);
+            else           processSamples<false, false> (block, endDelay, diffuseGain);
+        }
+
+        currentDelay_ = endDelay;
+        samplePos_   += numSamples;
+    }
+
+private:
+    /** Everything but the delay lines, the overlay and the read ramp (no allocation). */
+    void copyRunningState (const DelayModule& other)
+    {
+        jassert (bufSize_ == other.bufSize_);   // same spec
+
         for (int ch = 0; ch < 2; ++ch)
-            toneLPF[ch].setCutoffFrequency (toneCutoff);
+        {
+            writePos[ch] = other.writePos[ch];
+            toneLPF[ch]  = other.toneLPF[ch];
+        }
+
+        tone_       = other.tone_;
+
+        fb          = other.fb;
+        wetLevel_   = other.wetLevel_;
+        width       = other.width;
+        isPingPong  = other.isPingPong;
+        isFreeTime_ = other.isFreeTime_;
+        freeDelaySamples_ = other.freeDelaySamples_;
+        satAmount_  = other.satAmount_;
+        diffuseAmount_ = other.diffuseAmount_;
+        if (diffuseAmount_ > 0.0f)
+            diffuser_.copyStateFrom (other.diffuser_);   // otherwise cleared when diffuse returns
+
+        wowOsc_       = other.wowOsc_;
+        flutterOsc_   = other.flutterOsc_;
+        driftRng_     = other.driftRng_;
+        driftTarget_  = other.driftTarget_;
+        driftValue_   = other.driftValue_;
+        driftSmooth_  = other.driftSmooth_;
+        driftCountdown_ = other.driftCountdown_;
+        for (int m = 0; m < kNumModSources; ++m)
+        {
+            modDepth_[m]       = other.modDepth_[m];
+            modDepthTarget_[m] = other.modDepthTarget_[m];
+        }
+
+        // Only the tempo segments in use (usually one)
+        for (int64_t k = other.oldestAnchor_; k <= other.newestAnchor_; ++k)
+            anchorAt (k) = other.anchorAt (k);
+
+        oldestAnchor_ = other.oldestAnchor_;
+        newestAnchor_ = other.newestAnchor_;
+        anchorCursor_ = other.anchorCursor_;
+        samplePos_    = other.samplePos_;
+    }
+
+    // ── Per-sample loop ─────────────────────────────────────────────────
+    /** Line sample at ring index `idx`, `s` samples into the block.  Through
+        the overlay, samples written since copyStateFrom() come from it and
+        older ones from the live instance's line. */
+    template <bool Overlay>
+    float lineAt (int ch, int idx, int s) const noexcept
+    {
+        if constexpr (Overlay)
+        {
+            int age = writePos[ch] - idx;   // 1 = the last sample written
+            if (age <= 0)
+                age += bufSize_;
+
+            const int own = overlayCount_ + s;
+            return age <= own ? overlay_[ch][own - age]
+                              : overlaySource_->delayLine[ch][static_cast<size_t> (idx)];
+        }
+        else
+        {
+            juce::ignoreUnused (s);
+            return delayLine[ch][static_cast<size_t> (idx)];
+        }
     }
 
-    void process (juce::AudioBuffer<float>& buffer)
+    /** One block, read interpolation and the overlay fixed at compile time. */
+    template <bool Modulated, bool Overlay>
+    void processSamples (juce::dsp::AudioBlock<float>& block, double endDelay, float diffuseGain)
     {
-        const int numSamples = buffer.getNumSamples();
-        const int channels = std::min (buffer.getNumChannels(), 2);
+        const int numSamples = static_cast<int> (block.getNumSamples());
+        const int channels = std::min (static_cast<int> (block.getNumChannels()), 2);
+        const double delayInc = (endDelay - currentDelay_) / std::max (1, numSamples);
+
+        float depthInc[kNumModSources] {};
+        if constexpr (Modulated)
+            for (int m = 0; m < kNumModSources; ++m)
+                depthInc[m] = (modDepthTarget_[m] - modDepth_[m]) / static_cast<float> (std::max (1, numSamples));
+
+        // Hermite reads one sample ahead of the read point, so stay ≥ 3 behind the writer
+        const double minDelay = Modulated ? 3.0 : 1.0;
+        const double maxDelay = static_cast<double> (bufSize_ - 4);
 
         for (int s = 0; s < numSamples; ++s)
         {
-            // Advance smoothed delay time once per sample (shared by both channels)
-            const float currentDelay = smoothDelay_.getNextValue();
+            double delay = currentDelay_ + delayInc * s;
+
+            if constexpr (Modulated)
+            {
+                for (int m = 0; m < kNumModSources; ++m)
+                    modDepth_[m] += depthInc[m];
+
+                delay += modDepth_[wow]     * wowOsc_.next()
+                       + modDepth_[flutter] * flutterOsc_.next()
+                       + modDepth_[drift]   * nextDrift();
+            }
+
+            const float currentDelay = static_cast<float> (std::clamp (delay, minDelay, maxDelay));
 
             // ── Read delayed samples for all channels FIRST (before any writes) ──
             float delayed[2] = { 0.0f, 0.0f };
@@ -131,7 +472,7 @@ public:
                 if (readPosF < 0.0f)
                     readPosF += static_cast<float> (bufSize_);
 
-                // Fractional delay read (linear interpolation)
+                // Fractional delay read
                 int idx0 = static_cast<int> (std::floor (readPosF));
                 float frac = readPosF - std::floor (readPosF);
 
@@ -140,33 +481,61 @@ public:
                 if (idx0 >= bufSize_) idx0 -= bufSize_;
                 int idx1 = (idx0 + 1 >= bufSize_) ? 0 : idx0 + 1;
 
-                delayed[ch] = delayLine[ch][static_cast<size_t> (idx0)] * (1.0f - frac)
-                            + delayLine[ch][static_cast<size_t> (idx1)] * frac;
-            }
-
-            // ── Process feedback, write, width, and output per channel ──────────
-            for (int ch = 0; ch < channels; ++ch)
-            {
-                auto* data = buffer.getWritePointer (ch);
 
-                // Apply tone filter to feedback signal
-                float filteredFeedback = toneLPF[ch].processSample (ch, delayed[ch]);
-
-                // Determine feedback input
-                float feedbackSample;
-                if (isPingPong && channels == 2)
+                if constexpr (Modulated)
                 {
-                    // Ping-pong: feed the OTHER channel's delayed signal
-                    int otherCh = 1 - ch;
-                    feedbackSample = toneLPF[ch].processSample (ch, delayed[otherCh]) * fb;
+                    // 4-point Hermite (Catmull-Rom) — keeps modulated repeats from dulling
+                    const int idxM1 = (idx0 == 0) ? bufSize_ - 1 : idx0 - 1;
+                    const int idx2  = (idx1 + 1 >= bufSize_) ? 0 : idx1 + 1;
+
+                    const float xm1 = lineAt<Overlay> (ch, idxM1, s);
+                    const float x0  = lineAt<Overlay> (ch, idx0, s);
+                    const float x1  = lineAt<Overlay> (ch, idx1, s);
+                    const float x2  = lineAt<Overlay> (ch, idx2, s);
+
+                    const float c1 = 0.5f * (x1 - xm1);
+                    const float c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+                    const float c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+                    delayed[ch] = ((c3 * frac + c2) * frac + c1) * frac + x0;
                 }
                 else
                 {
-                    feedbackSample = filteredFeedback * fb;
+                    // Linear interpolation
+                    delayed[ch] = lineAt<Overlay> (ch, idx0, s) * (1.0f - frac)
+                                + lineAt<Overlay> (ch, idx1, s) * frac;
                 }
+            }
+
+            // ── Feedback: tone filter (ping-pong feeds the OTHER channel),
+            //    diffusion, then saturation ──
+            float feedbackSample[2] = { 0.0f, 0.0f };
+            for (int ch = 0; ch < channels; ++ch)
+            {
+                const int srcCh = (isPingPong && channels == 2) ? 1 - ch : ch;
+                feedbackSample[ch] = toneLPF[ch].processSample (ch, delayed[srcCh]) * fb;
+            }
+
+            if (diffuseAmount_ > 0.0f)
+            {
+                float diffused[2] = { feedbackSample[0], feedbackSample[1] };
+                diffuser_.process (diffused, diffuseGain);
+
+                for (int ch = 0; ch < 2; ++ch)
+                    feedbackSample[ch] += diffuseAmount_ * (diffused[ch] - feedbackSample[ch]);
+            }
+
+            saturate (feedbackSample, satAmount_);
+
+            // ── Write, width, and output per channel ────────────────────────
+            for (int ch = 0; ch < channels; ++ch)
+            {
+                auto* data = block.getChannelPointer (static_cast<size_t> (ch));
 
                 // Write to delay line: input + feedback
-                delayLine[ch][static_cast<size_t> (writePos[ch])] = data[s] + feedbackSample;
+                if constexpr (Overlay)
+                    overlay_[ch][overlayCount_ + s] = data[s] + feedbackSample[ch];
+                else
+                    delayLine[ch][static_cast<size_t> (writePos[ch])] = data[s] + feedbackSample[ch];
 
                 // Width: blend between mono delay (L=R average) and stereo
                 float wetSample = delayed[ch];
@@ -178,7 +547,7 @@ public:
                 }
 
                 // Mix delayed signal with dry
-                data[s] = data[s] + wetSample;
+                data[s] = data[s] + wetLevel_ * wetSample;
 
                 // Advance write position
                 writePos[ch]++;
@@ -186,22 +555,289 @@ public:
                     writePos[ch] = 0;
             }
         }
+
+        if constexpr (Modulated)
+        {
+            for (int m = 0; m < kNumModSources; ++m)
+                modDepth_[m] = modDepthTarget_[m];
+
+            wowOsc_.normalise();
+            flutterOsc_.normalise();
+        }
+    }
+
+    // ── Feedback saturation ─────────────────────────────────────────────
+    /** tanh(x) ≈ x (27 + x²) / (27 + 9x²), exact ±1 at |x| = 3 (input clamped there). */
+    static float rationalTanh (float x) noexcept
+    {
+        x = std::clamp (x, -3.0f, 3.0f);
+        const float x2 = x * x;
+        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+    }
+
+    /**
+     *  Blend the L/R feedback pair toward a soft-clipped copy, tanh (g·x) / g:
+     *  unity gain for small signals, ceiling 1 / g.  g runs from 1 to
+     *  1 + kSatDrive, so at full amount repeats flatten out around -6 dBFS
+     *  (knee just below it) instead of being squashed far under nominal
+     *  level.  Amount 0 leaves the pair exactly untouched.  Branch-free over
+     *  a fixed-size pair, so it vectorizes.
+     */
+    static void saturate (float (&x)[2], float amount) noexcept
+    {
+        const float drive = 1.0f + kSatDrive * amount;
+        const float invDrive = 1.0f / drive;
+
+        for (int ch = 0; ch < 2; ++ch)
+            x[ch] += amount * (rationalTanh (drive * x[ch]) * invDrive - x[ch]);
+    }
+
+    // ── Tape modulation ─────────────────────────────────────────────────
+    /**
+     *  Sine oscillator by rotation recurrence: the (cos, sin) pair is
+     *  rotated by a fixed angle per sample — two multiply-adds instead of
+     *  std::sin.  Amplitude is renormalised once per block.
+     */
+    struct RotationOscillator
+    {
+        float c = 1.0f, s = 0.0f;
+        float cosW = 1.0f, sinW = 0.0f;
+
+        void setFrequency (double hz, double sr)
+        {
+            const double w = 2.0 * juce::MathConstants<double>::pi * hz / sr;
+            cosW = static_cast<float> (std::cos (w));
+            sinW = static_cast<float> (std::sin (w));
+        }
+
+        void reset()   { c = 1.0f; s = 0.0f; }
+
+        float next() noexcept
+        {
+            const float nc = c * cosW - s * sinW;
+            s = s * cosW + c * sinW;
+            c = nc;
+            return s;
+        }
+
+        /** Pull the radius back to 1 (first-order correction, no sqrt). */
+        void normalise() noexcept
+        {
+            const float g = 1.5f - 0.5f * (c * c + s * s);
+            c *= g;
+            s *= g;
+        }
+    };
+
+    enum ModSource { wow = 0, flutter, drift, kNumModSources };
+
+    static constexpr double kWowHz     = 0.9;
+    static constexpr double kFlutterHz = 9.0;
+    static constexpr double kWowMaxMs     = 3.0;
+    static constexpr double kFlutterMaxMs = 0.25;
+    static constexpr double kDriftMaxMs   = 2.0;
+    static constexpr double kDriftStepsPerSecond = 2.5;   // new random target rate
+    static constexpr double kDriftSmoothHz       = 0.7;   // two one-poles smoothing the steps
+    static constexpr float  kMaxDiffusion = 0.7f;     // allpass gain at diffuse = 1
+    static constexpr float  kSatDrive     = 1.0f;     // saturation ceiling 1 / (1 + kSatDrive) at amount 1
+    static constexpr double kMaxModSeconds = 0.001 * (kWowMaxMs + kFlutterMaxMs + kDriftMaxMs);
+
+    /** Smoothed random drift, -1..+1. */
+    float nextDrift() noexcept
+    {
+        if (--driftCountdown_ <= 0)
+        {
+            driftCountdown_ = driftInterval_;
+            driftTarget_ = driftRng_.nextFloat() * 2.0f - 1.0f;
+        }
+
+        driftSmooth_ += driftCoeff_ * (driftTarget_ - driftSmooth_);
+        driftValue_  += driftCoeff_ * (driftSmooth_ - driftValue_);
+        return driftValue_;
+    }
+
+    void resetModulation()
+    {
+        wowOsc_.reset();
+        flutterOsc_.reset();
+        driftRng_.setSeed (0x7a9e);
+        driftTarget_ = driftValue_ = driftSmooth_ = 0.0f;
+        driftCountdown_ = 0;
+
+        for (int m = 0; m < kNumModSources; ++m)
+            modDepth_[m] = modDepthTarget_[m] = 0.0f;
+    }
+
+    // ── Beat grid → sample mapping ──────────────────────────────────────
+    /** Tempo segment: beat position `ppq` at sample `sample`, constant tempo after it. */
+    struct TempoAnchor
+    {
+        int64_t sample = 0;
+        double  ppq = 0.0;
+        double  beatsPerSample = 0.0;
+    };
+
+    static constexpr double  kMaxDelaySeconds = 4.0;
+    static constexpr int64_t kMaxAnchors = 4096;        // tempo segments kept
+    static constexpr double  kJumpToleranceBeats = 1.0 / 64.0;
+
+    TempoAnchor&       anchorAt (int64_t serial)       { return anchors_[static_cast<size_t> (serial % kMaxAnchors)]; }
+    const TempoAnchor& anchorAt (int64_t serial) const { return anchors_[static_cast<size_t> (serial % kMaxAnchors)]; }
+
+    void resetTimeline()
+    {
+        oldestAnchor_ = 0;
+        newestAnchor_ = -1;   // empty
+        anchorCursor_ = 0;
+        samplePos_    = 0;
+        delayValid_   = false;
+    }
+
+    /** Record the beat position at the current sample (new segment on tempo change). */
+    void addAnchor (double ppq, double beatsPerSample)
+    {
+        if (newestAnchor_ >= oldestAnchor_)
+        {
+            const auto& last = anchorAt (newestAnchor_);
+            const double predicted = last.ppq + static_cast<double> (samplePos_ - last.sample) * last.beatsPerSample;
+
+            if (std::abs (ppq - predicted) > kJumpToleranceBeats)
+            {
+                // Transport jump (loop, relocate, start/stop): restart the timeline
+                // here, with the history assumed to run at the current tempo.
+                oldestAnchor_ = newestAnchor_ + 1;
+                delayValid_   = false;
+            }
+            else if (beatsPerSample == last.beatsPerSample)
+            {
+                return;   // same tempo, same segment
+            }
+        }
+
+        ++newestAnchor_;
+        if (newestAnchor_ - oldestAnchor_ >= kMaxAnchors)
+            oldestAnchor_ = newestAnchor_ - kMaxAnchors + 1;
+
+        anchorCursor_ = std::clamp (anchorCursor_, oldestAnchor_, newestAnchor_);
+        anchorAt (newestAnchor_) = { samplePos_, ppq, beatsPerSample };
+    }
+
+    /** Max delay: 4 seconds (free-time maximum; 1 bar down to 60 BPM)
+        plus headroom for the tape modulation swing. */
+    static int bufferSizeFor (double rate) noexcept
+    {
+        return static_cast<int> (rate * (kMaxDelaySeconds + kMaxModSeconds)) + 4;
+    }
+
+    /**
+     *  Re-time a ring buffer to `newSize` samples in place (linear
+     *  interpolation).  The ring is first rotated so the oldest sample is at
+     *  index 0 and the newest at oldSize - 1; after stretching, the newest
+     *  sits at newSize - 1 and the next write goes to index 0.  Growing
+     *  writes from the end and shrinking from the start, so every read is
+     *  ahead of the writes.
+     */
+    static void resampleLine (float* line, int oldSize, int oldWritePos, int newSize) noexcept
+    {
+        std::rotate (line, line + oldWritePos, line + oldSize);
+
+        if (newSize == oldSize || oldSize < 2 || newSize < 2)
+            return;
+
+        const double ratio = static_cast<double> (oldSize - 1) / static_cast<double> (newSize - 1);
+
+        auto sampleAt = [line, ratio, oldSize] (int j)
+        {
+            const double pos  = j * ratio;
+            const int    i0   = std::min (static_cast<int> (pos), oldSize - 1);
+            const int    i1   = std::min (i0 + 1, oldSize - 1);
+            const float  frac = static_cast<float> (pos - i0);
+            return line[i0] + frac * (line[i1] - line[i0]);
+        };
+
+        if (newSize > oldSize)
+            for (int j = newSize - 1; j >= 0; --j)
+                line[j] = sampleAt (j);
+        else
+            for (int j = 0; j < newSize; ++j)
+                line[j] = sampleAt (j);
+    }
+
+    /** Samples between `nowSample` and the sample where the beat was `nowPpq - delayBeats_`. */
+    double gridDelaySamples (int64_t nowSample, double nowPpq)
+    {
+        if (newestAnchor_ < oldestAnchor_)
+            return 1.0;
+
+        const double targetPpq = nowPpq - delayBeats_;
+
+        // Segment containing the target beat.  The read point moves forward
+        // steadily, so the cursor only steps a segment at a time.
+        while (anchorCursor_ < newestAnchor_ && anchorAt (anchorCursor_ + 1).ppq <= targetPpq)
+            ++anchorCursor_;
+        while (anchorCursor_ > oldestAnchor_ && anchorAt (anchorCursor_).ppq > targetPpq)
+            --anchorCursor_;
+
+        const auto& seg = anchorAt (anchorCursor_);
+        const double targetSample = static_cast<double> (seg.sample)
+                                  + (targetPpq - seg.ppq) / seg.beatsPerSample;
+
+        return std::clamp (static_cast<double> (nowSample) - targetSample,
+                           1.0, static_cast<double> (bufSize_ - 2));
     }
 
-private:
     double sampleRate = 44100.0;
     int numChannels = 2;
     int bufSize_ = 0;
+    int bufCapacity_ = 0;   // samples assigned per line
 
-    std::vector<float> delayLine[2];
+    float* delayLine[2] = { nullptr, nullptr };   // bufSize_ used of each (arena, sized for capacityRate)
     int writePos[2] = { 0, 0 };
 
     float fb = 0.25f;
+    float wetLevel_ = 1.0f;
     float width = 0.7f;
     bool isPingPong = false;
 
     juce::dsp::StateVariableTPTFilter<float> toneLPF[2];
-
-    // Smoothed delay time in samples (avoids clicks on tempo/sync changes)
-    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> smoothDelay_;
+    CachedParam tone_;                        // delayTone the cutoff was computed from
+    static constexpr float kToneEpsilon = 1.0e-5f;
+    juce::SharedResourcePointer<DspTables> tables_;
+
+    // Beat grid state (delay time follows the tempo history exactly)
+    std::vector<TempoAnchor> anchors_;
+    int64_t oldestAnchor_ = 0;
+    int64_t newestAnchor_ = -1;
+    int64_t anchorCursor_ = 0;
+    int64_t samplePos_    = 0;       // samples processed since prepare / reset
+
+    // Tape section
+    RotationOscillator wowOsc_, flutterOsc_;
+    juce::Random driftRng_;
+    float driftTarget_ = 0.0f, driftSmooth_ = 0.0f, driftValue_ = 0.0f;
+    float driftCoeff_  = 0.0f;
+    int   driftInterval_ = 1, driftCountdown_ = 0;
+    float modDepth_[kNumModSources] {};          // samples, current
+    float modDepthTarget_[kNumModSources] {};    // samples, end of the next block
+    float satAmount_ = 0.0f;
+
+    // Feedback diffusion
+    StereoDiffuser diffuser_;
+    float diffuseAmount_ = 0.0f;
+
+    bool   isFreeTime_          = false;
+    double freeDelaySamples_    = 1.0;
+    float  delayBeats_          = 0.5f;
+    double blockPpq_            = 0.0;
+    double blockBeatsPerSample_ = 0.0;
+    double currentDelay_        = 1.0;  // delay in samples at the next sample
+    bool   delayValid_          = false;
+
+    // CrossfadeSwitch standby: own writes since copyStateFrom, older samples
+    // read from the live instance's lines
+    const DelayModule* overlaySource_ = nullptr;   // set while standing in for a fade
+    float* overlay_[2]   = { nullptr, nullptr };   // overlayCapacity_ samples each (arena)
+    int overlayCapacity_ = 0;
+    int overlayCount_    = 0;                      // samples written since the copy
+    int overlayChannels_ = 0;                      // channels written (1 for a mono pair)
 };
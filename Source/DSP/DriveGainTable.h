@@ -0,0 +1,75 @@
+#pragma once
+
+#include <algorithm>
+
+// Generated by tools/gen_drive_gain_table.py — do not edit by hand.
+
+/**
+ *  DriveGainTable — Offline-measured auto-gain for each drive curve
+ *
+ *  gain[curve][i] is the linear make-up gain that brings the curve's output
+ *  back to its input RMS at drive amount i / (kSize - 1), averaged over
+ *  reference signals (sine and noise at -18 dBFS, noise at -30 dBFS).
+ *  Capped at unity — the table only takes back loudness a curve adds.
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+namespace DriveGainTable
+{
+    static constexpr int kSize = 33;
+
+    static constexpr float gain[6][kSize] = {
+        {   // tanh
+            1.00000f, 0.41404f, 0.27394f, 0.21349f, 0.18056f, 0.16015f, 0.14636f, 0.13648f,
+            0.12906f, 0.12329f, 0.11868f, 0.11491f, 0.11178f, 0.10913f, 0.10686f, 0.10490f,
+            0.10318f, 0.10167f, 0.10033f, 0.09914f, 0.09806f, 0.09710f, 0.09622f, 0.09542f,
+            0.09469f, 0.09402f, 0.09340f, 0.09283f, 0.09230f, 0.09182f, 0.09136f, 0.09094f,
+            0.09054f,
+        },
+        {   // hard
+            1.00000f, 0.39521f, 0.24976f, 0.18768f, 0.15934f, 0.14310f, 0.13188f, 0.12354f,
+            0.11725f, 0.11220f, 0.10840f, 0.10526f, 0.10263f, 0.10039f, 0.09857f, 0.09709f,
+            0.09581f, 0.09469f, 0.09370f, 0.09281f, 0.09202f, 0.09129f, 0.09063f, 0.09003f,
+            0.08948f, 0.08896f, 0.08848f, 0.08804f, 0.08766f, 0.08736f, 0.08707f, 0.08681f,
+            0.08656f,
+        },
+        {   // tube
+            1.00000f, 0.60171f, 0.41584f, 0.32264f, 0.26742f, 0.23131f, 0.20610f, 0.18763f,
+            0.17361f, 0.16265f, 0.15386f, 0.14668f, 0.14071f, 0.13568f, 0.13137f, 0.12765f,
+            0.12440f, 0.12154f, 0.11901f, 0.11674f, 0.11471f, 0.11287f, 0.11120f, 0.10968f,
+            0.10829f, 0.10702f, 0.10584f, 0.10476f, 0.10375f, 0.10281f, 0.10194f, 0.10113f,
+            0.10037f,
+        },
+        {   // foldback
+            1.00000f, 0.78049f, 0.64000f, 0.54237f, 0.47067f, 0.41577f, 0.37254f, 0.33789f,
+            0.30977f, 0.28655f, 0.26725f, 0.25090f, 0.23695f, 0.22489f, 0.21441f, 0.20522f,
+            0.19709f, 0.19051f, 0.18605f, 0.18278f, 0.18010f, 0.17792f, 0.17609f, 0.17479f,
+            0.17352f, 0.17247f, 0.17192f, 0.17138f, 0.17079f, 0.17015f, 0.17004f, 0.17008f,
+            0.17006f,
+        },
+        {   // sineFold
+            0.64303f, 0.53017f, 0.45210f, 0.39502f, 0.35160f, 0.31755f, 0.29022f, 0.26787f,
+            0.24930f, 0.23369f, 0.22043f, 0.20907f, 0.19926f, 0.19074f, 0.18330f, 0.17677f,
+            0.17103f, 0.16597f, 0.16149f, 0.15752f, 0.15400f, 0.15087f, 0.14810f, 0.14563f,
+            0.14345f, 0.14152f, 0.13981f, 0.13832f, 0.13701f, 0.13587f, 0.13490f, 0.13407f,
+            0.13338f,
+        },
+        {   // crush
+            1.00000f, 1.00000f, 1.00000f, 1.00000f, 1.00000f, 1.00000f, 0.99999f, 0.99991f,
+            0.99993f, 0.99988f, 0.99997f, 1.00000f, 0.99992f, 0.99979f, 1.00000f, 0.99945f,
+            0.99961f, 0.99948f, 1.00000f, 0.99741f, 0.99832f, 0.99285f, 1.00000f, 0.99809f,
+            0.98557f, 0.98018f, 0.96256f, 0.94291f, 0.94271f, 0.95103f, 1.00000f, 1.00000f,
+            1.00000f,
+        },
+    };
+
+    /** Linear-interpolated make-up gain for a curve index and drive amount 0..1. */
+    inline float lookup (int curve, float amount01)
+    {
+        const float pos = std::clamp (amount01, 0.0f, 1.0f) * static_cast<float> (kSize - 1);
+        const int   i0  = std::min (static_cast<int> (pos), kSize - 2);
+        const float t   = pos - static_cast<float> (i0);
+        const auto& row = gain[curve];
+        return row[i0] + t * (row[i0 + 1] - row[i0]);
+    }
+}
@@ -1,7 +1,48 @@
 #pragma once
 
 #include <juce_dsp/juce_dsp.h>
+#include "AudioArena.h"
+#include "DriveGainTable.h"
+#include "CachedParam.h"
+#include "DspTables.h"
 #include <cmath>
+#include <cstdint>
+#include <iterator>
+
+/**
+ *  Waveshaper curve choices (scene param driveCurve).
+ *  Order must match driveCurveNames below.
+ */
+enum class DriveCurve
+{
+    tanh = 0,     // symmetric soft clip (original drive)
+    hard,         // hard clip at ±1
+    tube,         // asymmetric soft clip (even harmonics), DC-blocked
+    foldback,     // triangle wavefolder
+    sineFold,     // sine wavefolder
+    crush,        // bit depth + sample-rate reduction
+    kCount
+};
+
+static constexpr const char* driveCurveNames[] = {
+    "Tanh", "Hard", "Tube", "Fold", "SineFold", "Crush"
+};
+
+/**
+ *  Drive auto-gain modes (global param driveAutoGain).
+ *  Order must match driveAutoGainNames below.
+ */
+enum class DriveAutoGain
+{
+    off = 0,      // no compensation
+    table,        // offline-measured make-up gain (DriveGainTable.h)
+    tableRms,     // table, refined by a running input / output RMS ratio
+    kCount
+};
+
+static constexpr const char* driveAutoGainNames[] = {
+    "Off", "Table", "Table+RMS"
+};
 
 /**
  *  DriveModule — Waveshaper + Tone filter
@@ -9,10 +50,32 @@
  *  Params from Params.h:
  *    driveAmt   (0..1)  — drive intensity (0 = clean, 1 = heavy distortion)
  *    driveTone  (0..1)  — post-drive tone (0 = dark, 1 = bright)
+ *    driveCurve (0..5)  — waveshaper curve (DriveCurve)
+ *    crushBits  (2..16) — Lo-Fi bit depth (16 = off), continuous
+ *    crushRate  (1..32) — Lo-Fi downsample factor (1 = off), continuous
+ *    crushDither (bool) — TPDF dither before quantizing
+ *    driveAutoGain      — global loudness compensation (DriveAutoGain)
  *
  *  Implementation:
- *    - Soft-clip waveshaper: tanh(gain * x) where gain is derived from driveAmt
+ *    - Each curve is a small struct (params from drive amount + per-sample
+ *      apply); shapeBlock<Curve> instantiates one block kernel per curve.
+ *      process() picks the kernel once per block from a function-pointer
+ *      table, so the inner loop has no per-sample switch.
+ *    - Lo-Fi stage after the shaper, independent of the drive amount:
+ *      sample-and-hold at a fractional rate (phase accumulator), then
+ *      quantization vectorized with SIMDRegister — multiply by the level
+ *      count, round with the 1.5·2²³ add/subtract trick, multiply by the
+ *      precomputed reciprocal (no per-sample division)
+ *    - Auto-gain: make-up gain from DriveGainTable (per curve, interpolated
+ *      over the drive amount), optionally pulled toward the measured input /
+ *      output RMS ratio (~300 ms, within ±12 dB of the table).  The gain is
+ *      ramped across the block inside the shaper kernel, which also sums
+ *      x² / y² for the RMS — no extra pass over the audio
  *    - Post-drive tone filter: simple one-pole lowpass controlled by driveTone
+ *    - tanh, sine and the tone cutoff curve come from the shared DspTables
+ *    - Tone cutoff (SVF tan) and Lo-Fi levels (exp2) are only recomputed
+ *      when their smoothed inputs move (CachedParam)
+ *    - Curve changes crossfade via CrossfadeSwitch (copyStateFrom)
  *
  *  Lane A — DSP modules (Source/DSP/*)
  */
@@ -30,43 +93,145 @@ public:
         toneFilter.setType (juce::dsp::StateVariableTPTFilterType::lowpass);
         toneFilter.setCutoffFrequency (20000.0f);
         toneFilter.setResonance (0.707f);
+        tone_.invalidate();
+        bits_.invalidate();
+
+        // DC blocker for the asymmetric curve (~10 Hz)
+        dcCoeff_ = static_cast<float> (1.0 - 2.0 * juce::MathConstants<double>::pi * 10.0 / sampleRate);
+
+        reset();
     }
 
+    /** No audio memory of its own (AudioArena interface for CrossfadeSwitch). */
+    void assignBuffers (AudioArena&) {}
+    void assignStandbyBuffers (AudioArena&, int /*maxFadeSamples*/) {}
+
+    /** New sample rate: tone filter and DC blocker are re-derived. */
+    void changeSampleRate (const juce::dsp::ProcessSpec& spec)   { prepare (spec); }
+
     void reset()
     {
         toneFilter.reset();
+
+        for (auto& st : channelState_)
+            st = {};
+
+        makeupGain_ = 1.0f;
+        loudIn_     = 0.0f;
+        loudOut_    = 0.0f;
+    }
+
+    /** Pre-warm from another prepared instance (crossfade switching, no
+        allocation); all state is small, so it is copied at once. */
+    void copyStateFrom (const DriveModule& other, int /*fadeSamples*/)
+    {
+        toneFilter  = other.toneFilter;
+        driveAmount = other.driveAmount;
+        crushActive_    = other.crushActive_;
+        crushLevels_    = other.crushLevels_;
+        crushInvLevels_ = other.crushInvLevels_;
+        crushStep_      = other.crushStep_;
+        tone_           = other.tone_;
+        bits_           = other.bits_;
+        crushDither_    = other.crushDither_;
+        ditherState_    = other.ditherState_;
+        autoGain_       = other.autoGain_;
+        makeupGain_     = other.makeupGain_;
+        loudIn_         = other.loudIn_;
+        loudOut_        = other.loudOut_;
+
+        for (size_t ch = 0; ch < kMaxChannels; ++ch)
+            channelState_[ch] = other.channelState_[ch];
     }
 
+    /** End of a crossfade: the live instance takes the standby's state. */
+    void takeStateFrom (const DriveModule& standby)   { copyStateFrom (standby, 0); }
+
+    /** Lo-Fi stage params. */
+    struct CrushParams
+    {
+        float bits       = 16.0f;   // 2..16
+        float downsample = 1.0f;    // 1..32
+        bool  dither     = false;
+    };
+
     /**
+     *  @param curve     0..5 waveshaper curve (from Params::ID::driveCurve)
      *  @param amount01  0..1 drive amount (from Params::ID::driveAmt)
      *  @param tone01    0..1 tone control (from Params::ID::driveTone)
+     *  @param crush     Lo-Fi stage (from Params::ID::crushBits / crushRate / crushDither)
+     *  @param autoGain  loudness compensation (from Params::ID::driveAutoGain)
      */
-    void setParameters (float amount01, float tone01)
+    void setParameters (int curve, float amount01, float tone01, const CrushParams& crush,
+                        DriveAutoGain autoGain)
     {
+        curve_ = std::clamp (curve, 0, static_cast<int> (DriveCurve::kCount) - 1);
         driveAmount = amount01;
+        autoGain_   = autoGain;
+
+        // Lo-Fi: levels per unit of amplitude (fractional bit depths morph smoothly)
+        const float bits = std::clamp (crush.bits, 2.0f, 16.0f);
+        crushActive_    = bits < 15.999f || crush.downsample > 1.001f;
+        crushStep_      = 1.0f / std::clamp (crush.downsample, 1.0f, 32.0f);
+        crushDither_    = crush.dither;
+
+        if (bits_.update (bits, kParamEpsilon))
+        {
+            crushLevels_    = std::exp2 (bits - 1.0f);
+            crushInvLevels_ = 1.0f / crushLevels_;
+        }
 
         // Map tone 0..1 to cutoff frequency:
         //   0.0 → 800 Hz (dark)
         //   1.0 → 20000 Hz (bright / no filtering)
-        float toneCutoff = 800.0f * std::pow (25.0f, tone01);  // 800 → 20000 Hz
-        toneFilter.setCutoffFrequency (toneCutoff);
+        if (tone_.update (tone01, kParamEpsilon))
+            toneFilter.setCutoffFrequency (tables_->driveToneHz (tone01));  // 800 → 20000 Hz
     }
 
     void process (juce::dsp::AudioBlock<float>& block)
     {
-        if (driveAmount < 0.001f)
-            return;  // No drive — skip processing entirely
+        const bool shaping = driveAmount >= 0.001f;
+
+        if (! shaping && ! crushActive_)
+            return;  // No drive, no Lo-Fi — skip processing entirely
+
+        const auto numChannels = std::min (block.getNumChannels(), kMaxChannels);
+        const auto numSamples  = block.getNumSamples();
 
-        // Drive gain: map 0..1 to 1..50 (soft clip range)
-        const float driveGain = 1.0f + driveAmount * 49.0f;
+        // Waveshaper: one kernel per curve, chosen once per block.
+        // Make-up gain ramps from last block's value to this block's target.
+        if (shaping)
+        {
+            const auto kernel = kKernels[curve_];
+            const float target = makeupTarget();
+
+            GainRamp ramp;
+            ramp.start = makeupGain_;
+            ramp.step  = (target - makeupGain_) / static_cast<float> (numSamples);
+
+            for (size_t ch = 0; ch < numChannels; ++ch)
+                kernel (block.getChannelPointer (ch), numSamples,
+                        driveAmount, dcCoeff_, tables_.get(), channelState_[ch], ramp);
 
-        // Waveshaper: tanh soft clip
-        for (size_t ch = 0; ch < block.getNumChannels(); ++ch)
+            makeupGain_ = target;
+            updateLoudness (ramp, numChannels, numSamples);
+        }
+        else
         {
-            auto* data = block.getChannelPointer (ch);
-            for (size_t s = 0; s < block.getNumSamples(); ++s)
+            makeupGain_ = 1.0f;
+        }
+
+        // Lo-Fi: sample-and-hold (+ dither), then vectorized quantization
+        if (crushActive_)
+        {
+            for (size_t ch = 0; ch < numChannels; ++ch)
             {
-                data[s] = std::tanh (driveGain * data[s]);
+                auto* data = block.getChannelPointer (ch);
+
+                if (crushStep_ < 1.0f || crushDither_)
+                    sampleAndHold (data, numSamples, channelState_[ch]);
+
+                quantize (data, numSamples, crushLevels_, crushInvLevels_);
             }
         }
 
@@ -76,8 +241,278 @@ public:
     }
 
 private:
+    static constexpr size_t kMaxChannels = 2;
+    static constexpr float  kParamEpsilon = 1.0e-5f;   // below this, derived coefficients are kept
+
+    /** Per-channel memory used by the stateful curves. */
+    struct ChannelState
+    {
+        float dcIn = 0.0f, dcOut = 0.0f;   // tube DC blocker
+        float held = 0.0f;                 // crush sample-and-hold
+        int   holdCount = 0;
+        float lofiHeld  = 0.0f;            // Lo-Fi stage sample-and-hold
+        float lofiPhase = 1.0f;            // ≥ 1 → take a new sample
+    };
+
+    /** Make-up gain ramp for one block, plus the x² / y² sums the kernel gathers. */
+    struct GainRamp
+    {
+        float start = 1.0f, step = 0.0f;
+        float sumIn = 0.0f, sumOut = 0.0f;
+    };
+
+    /** Per-block constants derived from the drive amount. */
+    struct ShapeParams
+    {
+        float gain = 1.0f;
+        float levels = 1.0f, invLevels = 1.0f;   // crush quantizer
+        int   hold = 1;                          // crush decimation factor
+        float dcCoeff = 0.0f;
+        const DspTables* tables = nullptr;
+    };
+
+    // ── Curves ──────────────────────────────────────────────────────────
+    struct TanhCurve
+    {
+        static ShapeParams params (float amount) { return { 1.0f + amount * 49.0f }; }
+        static float apply (float x, const ShapeParams& p, ChannelState&) { return p.tables->tanh (p.gain * x); }
+    };
+
+    struct HardCurve
+    {
+        static ShapeParams params (float amount) { return { 1.0f + amount * 49.0f }; }
+        static float apply (float x, const ShapeParams& p, ChannelState&) { return std::clamp (p.gain * x, -1.0f, 1.0f); }
+    };
+
+    struct TubeCurve
+    {
+        // Biased soft clip: the positive half saturates later than the negative half
+        static constexpr float kBias = 0.35f;
+
+        static ShapeParams params (float amount) { return { 1.0f + amount * 29.0f }; }
+
+        static float apply (float x, const ShapeParams& p, ChannelState& st)
+        {
+            const float y = p.tables->tanh (p.gain * x + kBias) - p.tables->tanh (kBias);
+
+            // One-pole DC blocker removes the offset the asymmetry adds
+            const float out = y - st.dcIn + p.dcCoeff * st.dcOut;
+            st.dcIn  = y;
+            st.dcOut = out;
+            return out;
+        }
+    };
+
+    struct FoldbackCurve
+    {
+        static ShapeParams params (float amount) { return { 1.0f + amount * 9.0f }; }
+
+        static float apply (float x, const ShapeParams& p, ChannelState&)
+        {
+            // Triangle fold: identity in ±1, reflected back at the edges
+            float t = (p.gain * x + 1.0f) * 0.25f;
+            t -= std::floor (t);
+            return 1.0f - 4.0f * std::abs (t - 0.5f);
+        }
+    };
+
+    struct SineFoldCurve
+    {
+        static ShapeParams params (float amount) { return { 1.0f + amount * 7.0f }; }
+
+        static float apply (float x, const ShapeParams& p, ChannelState&)
+        {
+            // sin (π/2 · g·x) = sine table at g·x / 4 cycles
+            return p.tables->sine (p.gain * x * 0.25f);
+        }
+    };
+
+    struct CrushCurve
+    {
+        static ShapeParams params (float amount)
+        {
+            // 16 → 3 bits, hold 1 → 16 samples
+            ShapeParams p;
+            p.levels    = std::exp2 (15.0f - amount * 13.0f);
+            p.invLevels = 1.0f / p.levels;
+            p.hold      = 1 + static_cast<int> (amount * 15.0f);
+            return p;
+        }
+
+        static float apply (float x, const ShapeParams& p, ChannelState& st)
+        {
+            if (--st.holdCount <= 0)
+            {
+                st.holdCount = p.hold;
+                st.held = std::round (std::clamp (x, -1.0f, 1.0f) * p.levels) * p.invLevels;
+            }
+
+            return st.held;
+        }
+    };
+
+    // ── Block kernels ───────────────────────────────────────────────────
+    using Kernel = void (*) (float*, size_t, float, float, const DspTables&, ChannelState&, GainRamp&);
+
+    template <typename Curve>
+    static void shapeBlock (float* data, size_t numSamples, float amount, float dcCoeff,
+                            const DspTables& tables, ChannelState& st, GainRamp& ramp)
+    {
+        auto p = Curve::params (amount);
+        p.dcCoeff = dcCoeff;
+        p.tables  = &tables;
+
+        float g = ramp.start, sumIn = 0.0f, sumOut = 0.0f;
+
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            const float x = data[s];
+            const float y = Curve::apply (x, p, st);
+            sumIn  += x * x;
+            sumOut += y * y;
+            data[s] = y * g;
+            g += ramp.step;
+        }
+
+        ramp.sumIn  += sumIn;
+        ramp.sumOut += sumOut;
+    }
+
+    /** Indexed by DriveCurve. */
+    static constexpr Kernel kKernels[] = {
+        &shapeBlock<TanhCurve>,
+        &shapeBlock<HardCurve>,
+        &shapeBlock<TubeCurve>,
+        &shapeBlock<FoldbackCurve>,
+        &shapeBlock<SineFoldCurve>,
+        &shapeBlock<CrushCurve>,
+    };
+    static_assert (std::size (kKernels) == static_cast<size_t> (DriveCurve::kCount));
+
+    // ── Auto-gain ───────────────────────────────────────────────────────
+    static constexpr float kLoudnessTimeSec  = 0.3f;     // running RMS time constant
+    static constexpr float kLoudnessFloor    = 1.0e-6f;  // mean square below -60 dB: table only
+    static constexpr float kMaxRmsCorrection = 4.0f;     // ±12 dB around the table
+
+    /** Make-up gain target for the current curve / amount / mode (≤ 1). */
+    float makeupTarget() const noexcept
+    {
+        if (autoGain_ == DriveAutoGain::off)
+            return 1.0f;
+
+        const float table = DriveGainTable::lookup (curve_, driveAmount);
+
+        if (autoGain_ != DriveAutoGain::tableRms || loudIn_ < kLoudnessFloor)
+            return table;
+
+        const float measured = std::sqrt (loudIn_ / std::max (loudOut_, kLoudnessFloor * 1.0e-3f));
+        return std::min (1.0f, std::clamp (measured, table / kMaxRmsCorrection, table * kMaxRmsCorrection));
+    }
+
+    /** Fold one block's x² / y² sums into the running mean squares. */
+    void updateLoudness (const GainRamp& ramp, size_t numChannels, size_t numSamples) noexcept
+    {
+        if (numChannels == 0 || numSamples == 0)
+            return;
+
+        const float n = static_cast<float> (numChannels * numSamples);
+        const float a = 1.0f - std::exp (-static_cast<float> (numSamples)
+                                         / (kLoudnessTimeSec * static_cast<float> (sampleRate)));
+        loudIn_  += a * (ramp.sumIn  / n - loudIn_);
+        loudOut_ += a * (ramp.sumOut / n - loudOut_);
+    }
+
+    // ── Lo-Fi stage ─────────────────────────────────────────────────────
+    /** Fractional-rate sample-and-hold; TPDF dither (±1 LSB) added at each new sample. */
+    void sampleAndHold (float* data, size_t numSamples, ChannelState& st) noexcept
+    {
+        const float ditherAmount = crushDither_ ? crushInvLevels_ : 0.0f;
+
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            if (st.lofiPhase >= 1.0f)
+            {
+                st.lofiPhase -= 1.0f;
+                st.lofiHeld = data[s] + ditherAmount * (nextUniform() - nextUniform());
+            }
+
+            st.lofiPhase += crushStep_;
+            data[s] = st.lofiHeld;
+        }
+    }
+
+    /** Uniform 0..1 from a 32-bit xorshift (no allocation, deterministic). */
+    float nextUniform() noexcept
+    {
+        ditherState_ ^= ditherState_ << 13;
+        ditherState_ ^= ditherState_ >> 17;
+        ditherState_ ^= ditherState_ << 5;
+        return static_cast<float> (ditherState_ >> 8) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     *  Round to the nearest 1/levels step in place.  Adding then subtracting
+     *  1.5·2²³ rounds to an integer in float arithmetic (valid for |x| < 2²²,
+     *  so the input is clamped to ±8 first).  The aligned middle of the
+     *  block runs in SIMD registers, the unaligned head / tail in scalar.
+     */
+    static void quantize (float* data, size_t numSamples, float levels, float invLevels) noexcept
+    {
+        using Vec = juce::dsp::SIMDRegister<float>;
+        static constexpr float kRoundMagic = 12582912.0f;   // 1.5 * 2^23
+        static constexpr float kMaxAbs     = 8.0f;
+
+        auto quantizeScalar = [=] (float x)
+        {
+            const float scaled = std::clamp (x, -kMaxAbs, kMaxAbs) * levels;
+            return ((scaled + kRoundMagic) - kRoundMagic) * invLevels;
+        };
+
+        const auto* alignedStart = Vec::getNextSIMDAlignedPtr (data);
+        const auto head = std::min (numSamples, static_cast<size_t> (alignedStart - data));
+
+        size_t s = 0;
+        for (; s < head; ++s)
+            data[s] = quantizeScalar (data[s]);
+
+        const auto levelsV = Vec::expand (levels);
+        const auto invV    = Vec::expand (invLevels);
+        const auto magicV  = Vec::expand (kRoundMagic);
+        const auto loV     = Vec::expand (-kMaxAbs);
+        const auto hiV     = Vec::expand (kMaxAbs);
+
+        for (; s + Vec::SIMDNumElements <= numSamples; s += Vec::SIMDNumElements)
+        {
+            auto x = Vec::min (Vec::max (Vec::fromRawArray (data + s), loV), hiV) * levelsV;
+            x = ((x + magicV) - magicV) * invV;
+            x.copyToRawArray (data + s);
+        }
+
+        for (; s < numSamples; ++s)
+            data[s] = quantizeScalar (data[s]);
+    }
+
     double sampleRate = 44100.0;
     float driveAmount = 0.0f;
+    int   curve_      = 0;
+    float dcCoeff_    = 0.999f;
+    ChannelState channelState_[kMaxChannels];
+
+    bool     crushActive_    = false;
+    float    crushLevels_    = 32768.0f;
+    float    crushInvLevels_ = 1.0f / 32768.0f;
+    float    crushStep_      = 1.0f;
+    bool     crushDither_    = false;
+    uint32_t ditherState_    = 0x9e3779b9u;
+
+    DriveAutoGain autoGain_   = DriveAutoGain::off;
+    float         makeupGain_ = 1.0f;   // gain at the end of the last block
+    float         loudIn_     = 0.0f;   // running mean square, shaper input
+    float         loudOut_    = 0.0f;   // running mean square, shaper output (pre make-up)
     juce::dsp::StateVariableTPTFilter<float> toneFilter;
-};
 
+    // Last values the derived coefficients were computed from
+    CachedParam tone_, bits_;
+
+    juce::SharedResourcePointer<DspTables> tables_;
+};
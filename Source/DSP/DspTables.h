@@ -0,0 +1,103 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/**
+ *  DspTables — Immutable lookup tables shared by every plugin instance
+ *
+ *  Held through juce::SharedResourcePointer<DspTables>: the first pointer
+ *  created in the process builds the tables, later ones share them, and
+ *  they are freed with the last one.  Pointers are members of the modules
+ *  (and LfoBank), so they are created with the processor on the message
+ *  thread — never lazily on the audio thread.  After construction nothing
+ *  writes to the tables, so any number of audio threads can read them.
+ *
+ *    - tanh:      drive Tanh / Tube curves (±8 range, linear interpolation,
+ *                 error < 1e-6; saturates to ±1 outside)
+ *    - sine:      LFO sine / smooth random, drive SineFold curve
+ *                 (phase in cycles)
+ *    - tone maps: drive tone (800 → 20000 Hz) and delay tone
+ *                 (500 → 20000 Hz) exponential cutoff curves
+ *
+ *  JUCE's StateVariableTPTFilter computes its tan() prewarp internally, so
+ *  SVF coefficients are not tabulated here (CachedParam limits how often
+ *  they are recomputed instead).
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+class DspTables
+{
+public:
+    static constexpr int   kTanhSize  = 8192;
+    static constexpr float kTanhRange = 8.0f;     // tanh (8) = 1 - 2.3e-7
+    static constexpr int   kSineSize  = 2048;     // power of two (mask-wrapped)
+    static constexpr int   kToneSize  = 256;
+
+    DspTables()
+    {
+        for (int i = 0; i <= kTanhSize; ++i)
+        {
+            const double x = (static_cast<double> (i) / kTanhSize * 2.0 - 1.0) * kTanhRange;
+            tanh_[static_cast<size_t> (i)] = static_cast<float> (std::tanh (x));
+        }
+
+        for (int i = 0; i <= kSineSize; ++i)
+            sine_[static_cast<size_t> (i)] =
+                static_cast<float> (std::sin (2.0 * juce::MathConstants<double>::pi * i / kSineSize));
+
+        for (int i = 0; i <= kToneSize; ++i)
+        {
+            const double t = static_cast<double> (i) / kToneSize;
+            driveTone_[static_cast<size_t> (i)] = static_cast<float> (800.0 * std::pow (25.0, t));
+            delayTone_[static_cast<size_t> (i)] = static_cast<float> (500.0 * std::pow (40.0, t));
+        }
+    }
+
+    /** tanh (x), interpolated. */
+    float tanh (float x) const noexcept
+    {
+        constexpr float scale = static_cast<float> (kTanhSize) / (2.0f * kTanhRange);
+        const float pos = (std::clamp (x, -kTanhRange, kTanhRange) + kTanhRange) * scale;
+        const int   idx = std::min (static_cast<int> (pos), kTanhSize - 1);
+        return lerp (tanh_, idx, pos - static_cast<float> (idx));
+    }
+
+    /** sin (2π · phase), phase in cycles (any value, wrapped). */
+    float sine (float phase) const noexcept
+    {
+        const float pos  = (phase - std::floor (phase)) * static_cast<float> (kSineSize);
+        const int   idx  = static_cast<int> (pos) & (kSineSize - 1);
+        return lerp (sine_, idx, pos - std::floor (pos));
+    }
+
+    /** Drive tone cutoff: 0 → 800 Hz, 1 → 20000 Hz. */
+    float driveToneHz (float tone01) const noexcept   { return lookupTone (driveTone_, tone01); }
+
+    /** Delay feedback tone cutoff: 0 → 500 Hz, 1 → 20000 Hz. */
+    float delayToneHz (float tone01) const noexcept   { return lookupTone (delayTone_, tone01); }
+
+private:
+    template <size_t N>
+    static float lerp (const std::array<float, N>& table, int idx, float frac) noexcept
+    {
+        const float a = table[static_cast<size_t> (idx)];
+        const float b = table[static_cast<size_t> (idx + 1)];
+        return a + frac * (b - a);
+    }
+
+    static float lookupTone (const std::array<float, kToneSize + 1>& table, float tone01) noexcept
+    {
+        const float pos = std::clamp (tone01, 0.0f, 1.0f) * static_cast<float> (kToneSize);
+        const int   idx = std::min (static_cast<int> (pos), kToneSize - 1);
+        return lerp (table, idx, pos - static_cast<float> (idx));
+    }
+
+    // +1 guard point each for interpolation
+    std::array<float, kTanhSize + 1> tanh_ {};
+    std::array<float, kSineSize + 1> sine_ {};
+    std::array<float, kToneSize + 1> driveTone_ {};
+    std::array<float, kToneSize + 1> delayTone_ {};
+};
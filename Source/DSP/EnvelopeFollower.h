@@ -0,0 +1,132 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <cmath>
+
+/**
+ *  EnvelopeFollower — Attack/release level detectors for modulation
+ *
+ *  Tracks two stereo sources at once (main input + sidechain) with all four
+ *  channels packed into one SIMD register:
+ *
+ *      lane 0 = main L    lane 1 = main R    lane 2 = sidechain L    lane 3 = sidechain R
+ *
+ *  Each source has its own attack / release / detector mode, stored as
+ *  per-lane coefficient registers, so the per-sample loop is branch-free.
+ *
+ *  Detector modes:
+ *    - Peak: one-pole attack/release on |x|
+ *    - RMS:  one-pole attack/release on x², square-rooted when read
+ *
+ *  Levels are read once per control block and mapped from -60..0 dBFS to
+ *  0..1 so they can be routed to morph / macros like any other mod source.
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+class EnvelopeFollower
+{
+public:
+    enum Source { mainInput = 0, sidechain, kNumSources };
+    enum Mode   { peak = 0, rms, kNumModes };
+
+    EnvelopeFollower() = default;
+
+    void prepare (const juce::dsp::ProcessSpec& spec)
+    {
+        sampleRate = spec.sampleRate;
+        reset();
+    }
+
+    void reset()
+    {
+        env_ = Vec::expand (0.0f);
+    }
+
+    /**
+     *  @param source     mainInput or sidechain
+     *  @param attackMs   attack time in ms
+     *  @param releaseMs  release time in ms
+     *  @param mode       peak or rms
+     */
+    void setParameters (Source source, float attackMs, float releaseMs, Mode mode)
+    {
+        const auto lane0 = static_cast<size_t> (source) * 2;
+        const float att  = msToCoeff (attackMs);
+        const float rel  = msToCoeff (releaseMs);
+        const float sq   = (mode == rms) ? 1.0f : 0.0f;
+
+        for (size_t lane = lane0; lane < lane0 + 2; ++lane)
+        {
+            attack_.set  (lane, att);
+            release_.set (lane, rel);
+            square_.set  (lane, sq);
+        }
+
+        modes_[source] = mode;
+    }
+
+    /**
+     *  Run the detectors over one control block.  Any channel pointer may be
+     *  nullptr (mono input, sidechain not connected) — that lane reads silence.
+     *
+     *  @param channels  { mainL, mainR, sidechainL, sidechainR }
+     */
+    void process (const float* const channels[4], int numSamples)
+    {
+        alignas (Vec::SIMDRegisterSize) float frame[Vec::SIMDNumElements] {};
+
+        for (int s = 0; s < numSamples; ++s)
+        {
+            for (size_t lane = 0; lane < 4; ++lane)
+                frame[lane] = (channels[lane] != nullptr) ? channels[lane][s] : 0.0f;
+
+            const auto x = Vec::fromRawArray (frame);
+
+            // Detector input: |x| (peak lanes) or x² (rms lanes), branch-free blend
+            const auto rect = Vec::abs (x);
+            const auto in   = rect + square_ * (x * x - rect);
+
+            // Attack where the input rises above the envelope, release otherwise
+            const auto rising = Vec::greaterThan (in, env_);
+            const auto coeff  = (attack_ & rising) + (release_ & (~rising));
+
+            env_ = env_ + coeff * (in - env_);
+        }
+    }
+
+    /** Current level of a source, mapped -60..0 dBFS → 0..1. */
+    float getLevel01 (Source source) const
+    {
+        const auto lane0 = static_cast<size_t> (source) * 2;
+        float level = std::max (env_.get (lane0), env_.get (lane0 + 1));
+
+        if (modes_[source] == rms)
+            level = std::sqrt (level);
+
+        if (level < 1.0e-3f)
+            return 0.0f;   // below -60 dBFS
+
+        const float db = 20.0f * std::log10 (level);
+        return std::clamp ((db + 60.0f) / 60.0f, 0.0f, 1.0f);
+    }
+
+private:
+    using Vec = juce::dsp::SIMDRegister<float>;
+    static_assert (Vec::SIMDNumElements >= 4, "EnvelopeFollower packs 4 channels per register");
+
+    /** One-pole coefficient for a time constant in ms. */
+    float msToCoeff (float ms) const
+    {
+        const double samples = std::max (0.01, static_cast<double> (ms)) * 0.001 * sampleRate;
+        return static_cast<float> (1.0 - std::exp (-1.0 / samples));
+    }
+
+    double sampleRate = 44100.0;
+
+    Vec env_     = Vec::expand (0.0f);
+    Vec attack_  = Vec::expand (1.0f);
+    Vec release_ = Vec::expand (1.0f);
+    Vec square_  = Vec::expand (0.0f);   // 1 in RMS lanes, 0 in peak lanes
+
+    Mode modes_[kNumSources] = { peak, peak };
+};
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <juce_dsp/juce_dsp.h>
+#include "AudioArena.h"
+#include "CachedParam.h"
 
 /**
  *  FilterModule — SVF (State Variable TPT) Filter
@@ -8,6 +10,10 @@
  *  Wraps juce::dsp::StateVariableTPTFilter with the parameter interface
  *  defined in Params.h (filtMode, filtCutoffHz, filtReso).
  *
+ *  Coefficients (tan() per cutoff / resonance change) are only recomputed
+ *  when the smoothed values move (CachedParam), so an idle filter costs
+ *  nothing in setParameters().
+ *
  *  Lane A — DSP modules (Source/DSP/*)
  */
 class FilterModule
@@ -21,13 +27,37 @@ public:
         filter.setType (juce::dsp::StateVariableTPTFilterType::lowpass);
         filter.setCutoffFrequency (8000.0f);
         filter.setResonance (0.707f);   // flat (no resonance boost)
+
+        mode_ = -1;
+        cutoff_.invalidate();
+        reso_.invalidate();
     }
 
+    /** No audio memory of its own (AudioArena interface for CrossfadeSwitch). */
+    void assignBuffers (AudioArena&) {}
+    void assignStandbyBuffers (AudioArena&, int /*maxFadeSamples*/) {}
+
+    /** New sample rate: only the SVF coefficients depend on it. */
+    void changeSampleRate (const juce::dsp::ProcessSpec& spec)   { prepare (spec); }
+
     void reset()
     {
         filter.reset();
     }
 
+    /** Pre-warm from another prepared instance (crossfade switching, no
+        allocation); all state is small, so it is copied at once. */
+    void copyStateFrom (const FilterModule& other, int /*fadeSamples*/)
+    {
+        filter  = other.filter;
+        mode_   = other.mode_;
+        cutoff_ = other.cutoff_;
+        reso_   = other.reso_;
+    }
+
+    /** End of a crossfade: the live instance takes the standby's state. */
+    void takeStateFrom (const FilterModule& standby)   { copyStateFrom (standby, 0); }
+
     /**
      *  Update filter parameters (call once per processBlock, before processing).
      *
@@ -38,15 +68,24 @@ public:
     void setParameters (int mode, float cutoffHz, float reso01)
     {
         // Map mode index to JUCE filter type
-        switch (mode)
+        if (mode != mode_)
         {
-            case 0:  filter.setType (juce::dsp::StateVariableTPTFilterType::lowpass);   break;
-            case 1:  filter.setType (juce::dsp::StateVariableTPTFilterType::bandpass);  break;
-            case 2:  filter.setType (juce::dsp::StateVariableTPTFilterType::highpass);  break;
-            default: filter.setType (juce::dsp::StateVariableTPTFilterType::lowpass);   break;
+            mode_ = mode;
+
+            switch (mode)
+            {
+                case 0:  filter.setType (juce::dsp::StateVariableTPTFilterType::lowpass);   break;
+                case 1:  filter.setType (juce::dsp::StateVariableTPTFilterType::bandpass);  break;
+                case 2:  filter.setType (juce::dsp::StateVariableTPTFilterType::highpass);  break;
+                default: filter.setType (juce::dsp::StateVariableTPTFilterType::lowpass);   break;
+            }
         }
 
-        filter.setCutoffFrequency (cutoffHz);
+        if (cutoff_.update (cutoffHz, kCutoffEpsilonHz))
+            filter.setCutoffFrequency (cutoffHz);
+
+        if (! reso_.update (reso01, kResoEpsilon))
+            return;
 
         // Map normalised resonance (0..1) to JUCE SVF resonance.
         // JUCE SVF resonance: values < 1/sqrt(2) ≈ 0.707 = more resonance (higher Q)
@@ -62,13 +101,20 @@ public:
     /**
      *  Process an audio block in-place.
      */
-    template <typename ProcessContext>
-    void process (const ProcessContext& context)
+    void process (juce::dsp::AudioBlock<float>& block)
     {
+        juce::dsp::ProcessContextReplacing<float> context (block);
         filter.process (context);
     }
 
 private:
+    static constexpr float kCutoffEpsilonHz = 0.01f;
+    static constexpr float kResoEpsilon     = 1.0e-5f;
+
     juce::dsp::StateVariableTPTFilter<float> filter;
+
+    // Last values the coefficients were computed from
+    int         mode_ = -1;
+    CachedParam cutoff_, reso_;
 };
 
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "AudioArena.h"
+#include <algorithm>
+
+/**
+ *  Stereo processing mode (global param stereoMode).
+ *  Order must match stereoModeNames below.
+ */
+enum class StereoMode
+{
+    leftRight = 0,   // modules see L / R
+    midSide,         // modules see M / S (encoded at input gain, decoded before the mix)
+    kCount
+};
+
+static constexpr const char* stereoModeNames[] = {
+    "L/R", "M/S"
+};
+
+/**
+ *  Per-module channel routing in M/S mode (scene params filtMsRoute ..
+ *  revMsRoute).  Order must match msRouteNames below.
+ */
+enum class MsRoute
+{
+    both = 0,
+    mid,             // channel 0 only
+    side,            // channel 1 only
+    kCount
+};
+
+static constexpr const char* msRouteNames[] = {
+    "Both", "Mid", "Side"
+};
+
+/**
+ *  MidSide — M/S encode / decode fused into the gain passes
+ *
+ *  With M = (L + R) / 2 and S = (L - R) / 2, decoding is L = M + S,
+ *  R = M - S (unity round trip).  The processor already walks the whole
+ *  buffer once for the input gain and once for the output gain, so the
+ *  encode rides along with the input gain and the decode with the dry/wet
+ *  mix and output gain — M/S costs no extra pass over the audio.
+ *
+ *  The gains are juce::SmoothedValue (20 ms): constant gain is a plain
+ *  vector multiply, a ramp is applied per sample.  On a multichannel bus
+ *  each channel pair is encoded / decoded on its own (a lone last channel
+ *  stays as it is).
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+namespace MidSide
+{
+    /** Smoothed gain over the first numChannels channels (L/R and mono path). */
+    inline void applyGain (juce::AudioBuffer<float>& buffer, int numChannels, int numSamples,
+                           juce::SmoothedValue<float>& gain) noexcept
+    {
+        if (! gain.isSmoothing())
+        {
+            const float g = gain.getTargetValue();
+
+            if (g != 1.0f)
+                for (int ch = 0; ch < numChannels; ++ch)
+                    juce::FloatVectorOperations::multiply (buffer.getWritePointer (ch), g, numSamples);
+            return;
+        }
+
+        for (int s = 0; s < numSamples; ++s)
+        {
+            const float g = gain.getNextValue();
+            for (int ch = 0; ch < numChannels; ++ch)
+                buffer.getWritePointer (ch)[s] *= g;
+        }
+    }
+
+    /** Smoothed gain on one channel (a channel without an M/S partner). */
+    inline void applyGain (float* data, int numSamples, juce::SmoothedValue<float>& gain) noexcept
+    {
+        if (! gain.isSmoothing())
+        {
+            if (gain.getTargetValue() != 1.0f)
+                juce::FloatVectorOperations::multiply (data, gain.getTargetValue(), numSamples);
+            return;
+        }
+
+        for (int s = 0; s < numSamples; ++s)
+            data[s] *= gain.getNextValue();
+    }
+
+    /** Input gain + L/R → M/S, in place on one channel pair. */
+    inline void encode (float* l, float* r, int numSamples, juce::SmoothedValue<float>& gain) noexcept
+    {
+        if (! gain.isSmoothing())
+        {
+            const float g = 0.5f * gain.getTargetValue();
+
+            for (int s = 0; s < numSamples; ++s)
+            {
+                const float m = g * (l[s] + r[s]);
+                r[s] = g * (l[s] - r[s]);
+                l[s] = m;
+            }
+            return;
+        }
+
+        for (int s = 0; s < numSamples; ++s)
+        {
+            const float g = 0.5f * gain.getNextValue();
+            const float m = g * (l[s] + r[s]);
+            r[s] = g * (l[s] - r[s]);
+            l[s] = m;
+        }
+    }
+
+    /**
+     *  M/S → L/R, dry/wet mix and output gain, in place on one channel pair.
+     *  `dryL` / `dryR` are the untouched L/R input.  `retM` / `retS`, if
+     *  given, are a parallel return (M/S) summed into the wet signal.
+     */
+    inline void decodeMix (float* m, float* s, const float* dryL, const float* dryR, int numSamples,
+                           float mix, juce::SmoothedValue<float>& gain,
+                           const float* retM = nullptr, const float* retS = nullptr) noexcept
+    {
+        const bool smoothing = gain.isSmoothing();
+        const float target = gain.getTargetValue();
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float g  = smoothing ? gain.getNextValue() : target;
+            const float wm = retM != nullptr ? m[i] + retM[i] : m[i];
+            const float ws = retS != nullptr ? s[i] + retS[i] : s[i];
+            const float l  = wm + ws;
+            const float r  = wm - ws;
+
+            m[i] = g * (dryL[i] + mix * (l - dryL[i]));
+            s[i] = g * (dryR[i] + mix * (r - dryR[i]));
+        }
+    }
+
+    /** Dry/wet mix and output gain for a channel without an M/S partner
+        (last channel of an odd layout); `ret` as in decodeMix. */
+    inline void mixSingle (float* wet, const float* dry, int numSamples, float mix,
+                           juce::SmoothedValue<float>& gain, const float* ret = nullptr) noexcept
+    {
+        const bool smoothing = gain.isSmoothing();
+        const float target = gain.getTargetValue();
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float g = smoothing ? gain.getNextValue() : target;
+            const float w = ret != nullptr ? wet[i] + ret[i] : wet[i];
+
+            wet[i] = g * (dry[i] + mix * (w - dry[i]));
+        }
+    }
+}
+
+/**
+ *  MsRouter — Runs a stereo module on the mid, the side, or both
+ *
+ *  A module routed to one channel gets silence on the other, and that
+ *  channel's output is restored to what it was before the module.  Each
+ *  channel's route gain ramps over 20 ms, so changing the route (a discrete
+ *  scene param) is click-free:
+ *
+ *      module input  = g · x
+ *      output        = x + g · (y − x)
+ *
+ *  With both gains settled at 1 (L/R mode, or route Both) the module runs
+ *  directly on the block — no copy.  Otherwise the routed-out channel is
+ *  saved to a scratch buffer from the processor's AudioArena.
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+class MsRouter
+{
+public:
+    MsRouter() = default;
+
+    void prepare (const juce::dsp::ProcessSpec& spec, double fadeSeconds = 0.02)
+    {
+        maxBlockSize_ = static_cast<int> (spec.maximumBlockSize);
+        changeSampleRate (spec, fadeSeconds);
+        reset();
+    }
+
+    /** Scratch for the two channels (size from prepare()). */
+    void assignBuffers (AudioArena& arena)
+    {
+        arena.assign (saved_, 2, maxBlockSize_);
+    }
+
+    /** New sample rate: only the ramp length changes; gains keep their values. */
+    void changeSampleRate (const juce::dsp::ProcessSpec& spec, double fadeSeconds = 0.02)
+    {
+        step_ = 1.0f / static_cast<float> (std::max (1.0, spec.sampleRate * fadeSeconds));
+    }
+
+    void reset()
+    {
+        gain_[0] = gain_[1] = 1.0f;
+    }
+
+    /**
+     *  Process one block with the given route.
+     *
+     *  @param block      audio to process (M/S or L/R pair; mono passes straight through)
+     *  @param route      which channel(s) the module acts on
+     *  @param runModule  callable (juce::dsp::AudioBlock<float>&) running the module
+     */
+    template <typename RunModule>
+    void process (juce::dsp::AudioBlock<float>& block, MsRoute route, RunModule&& runModule)
+    {
+        const float target[2] = { route == MsRoute::side ? 0.0f : 1.0f,
+                                  route == MsRoute::mid  ? 0.0f : 1.0f };
+
+        if (block.getNumChannels() < 2
+            || (gain_[0] == 1.0f && gain_[1] == 1.0f && target[0] == 1.0f && target[1] == 1.0f))
+        {
+            runModule (block);
+            return;
+        }
+
+        const int numSamples = static_cast<int> (block.getNumSamples());
+        jassert (numSamples <= saved_.getNumSamples());
+
+        float start[2], inc[2];
+        for (size_t ch = 0; ch < 2; ++ch)
+        {
+            // Ramp toward the target by up to one step per sample
+            const float end = gain_[ch] + std::clamp (target[ch] - gain_[ch],
+                                                      -step_ * static_cast<float> (numSamples),
+                                                       step_ * static_cast<float> (numSamples));
+            start[ch] = gain_[ch];
+            inc[ch]   = (end - start[ch]) / static_cast<float> (std::max (1, numSamples));
+            gain_[ch] = end;
+        }
+
+        // Save the input and scale what the module sees
+        for (size_t ch = 0; ch < 2; ++ch)
+        {
+            if (start[ch] == 1.0f && inc[ch] == 0.0f)
+                continue;
+
+            auto* data  = block.getChannelPointer (ch);
+            auto* saved = saved_.getWritePointer (static_cast<int> (ch));
+
+            for (int s = 0; s < numSamples; ++s)
+            {
+                saved[s] = data[s];
+                data[s] *= start[ch] + inc[ch] * static_cast<float> (s + 1);
+            }
+        }
+
+        runModule (block);
+
+        for (size_t ch = 0; ch < 2; ++ch)
+        {
+            if (start[ch] == 1.0f && inc[ch] == 0.0f)
+                continue;
+
+            auto* data = block.getChannelPointer (ch);
+            const auto* saved = saved_.getReadPointer (static_cast<int> (ch));
+
+            for (int s = 0; s < numSamples; ++s)
+                data[s] = saved[s] + (start[ch] + inc[ch] * static_cast<float> (s + 1)) * (data[s] - saved[s]);
+        }
+    }
+
+private:
+    float gain_[2] = { 1.0f, 1.0f };   // route gain per channel at the end of the last block
+    float step_    = 1.0f;             // gain change per sample while ramping
+
+    juce::AudioBuffer<float> saved_;   // routed-out channel input (arena)
+    int maxBlockSize_ = 0;
+};
@@ -1,6 +1,107 @@
 #pragma once
 
 #include <juce_dsp/juce_dsp.h>
+#include "CachedParam.h"
+#include "AudioArena.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/**
+ *  Early-reflection room shape (scene param revRoom).
+ *  Order must match roomShapeNames below.
+ */
+enum class RoomShape
+{
+    room = 0,   //  8 taps, 25 ms span
+    chamber,    // 12 taps, 45 ms
+    hall,       // 16 taps, 70 ms
+    church,     // 24 taps, 100 ms
+    kCount
+};
+
+static constexpr const char* roomShapeNames[] = {
+    "Room", "Chamber", "Hall", "Church"
+};
+
+/**
+ *  Early-reflection tap patterns, one per RoomShape.
+ *
+ *  Tap times are fractions of the shape's span (scaled by revSize at run
+ *  time), spread one per slot with fixed jitter and, for the larger shapes,
+ *  bunched toward the end, where reflections arrive denser.  L / R times
+ *  differ so the pattern decorrelates the channels.  Gains fall with time
+ *  and alternate in sign; the sum of squares is about 1 for every shape.
+ */
+namespace EarlyReflections
+{
+    static constexpr int kMaxTaps = 24;
+
+    struct Tap
+    {
+        float timeL, timeR;   // 0..1 of the span
+        float gain;
+    };
+
+    struct Shape
+    {
+        int   numTaps;
+        float spanMs;         // at revSize = 1 (a quarter of it at 0)
+        float bunch;          // 0..0.5: how far late taps are pulled together
+        std::array<Tap, kMaxTaps> taps;
+    };
+
+    constexpr Shape makeShape (int numTaps, float spanMs, float bunch, unsigned seed)
+    {
+        Shape shape { numTaps, spanMs, bunch, {} };
+
+        auto next = [&seed]
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return static_cast<float> (seed >> 8) / 16777216.0f;   // 0..1
+        };
+
+        float sumSquares = 0.0f;
+
+        for (int k = 0; k < numTaps; ++k)
+        {
+            const float n = static_cast<float> (numTaps);
+            float t = (static_cast<float> (k) + 0.5f + 0.7f * (next() - 0.5f)) / n;
+            t = std::clamp (t, 0.02f, 1.0f);
+
+            // Bend toward the end (1 - (1 - t)^(1..2)): later taps closer together
+            const float u = 1.0f - t;
+            t = std::max (0.02f, 1.0f - (u * (1.0f - bunch) + u * u * bunch));
+
+            auto& tap = shape.taps[static_cast<size_t> (k)];
+            tap.timeL = t;
+            tap.timeR = std::clamp (t * (0.85f + 0.3f * next()), 0.02f, 1.0f);
+            tap.gain  = ((k % 2) != 0 ? -1.0f : 1.0f) * (1.0f - 0.7f * t);
+
+            sumSquares += tap.gain * tap.gain;
+        }
+
+        // Normalise (Newton iterations for 1 / sqrt: no constexpr sqrt in C++17;
+        // 1 / x starts below the root for x > 1, where the iteration converges)
+        float inv = sumSquares > 1.0f ? 1.0f / sumSquares : 1.0f;
+        for (int i = 0; i < 12; ++i)
+            inv = inv * (1.5f - 0.5f * sumSquares * inv * inv);
+
+        for (int k = 0; k < numTaps; ++k)
+            shape.taps[static_cast<size_t> (k)].gain *= inv;
+
+        return shape;
+    }
+
+    static constexpr std::array<Shape, static_cast<size_t> (RoomShape::kCount)> shapes = {{
+        makeShape ( 8,  25.0f, 0.0f,  0x1234u),
+        makeShape (12,  45.0f, 0.15f, 0x5678u),
+        makeShape (16,  70.0f, 0.3f,  0x9abcu),
+        makeShape (24, 100.0f, 0.45f, 0xdef0u),
+    }};
+
+    static constexpr float kMaxSpanMs = 100.0f;
+}
 
 /**
  *  ReverbModule — Simple algorithmic reverb
@@ -13,10 +114,38 @@
  *    revDamp      (0..1)     — damping / tone
  *    revPreDelay  (0..200)   — pre-delay in ms
  *    revWidth     (0..1)     — stereo width
+ *    revLevel     (0..1)     — wet level (parallel return; 1 in serial)
+ *    revFreeze    (bool)     — freeze the tail (Freeverb freezeMode)
+ *    revEarly     (0..1)     — early-reflection level
+ *    revRoom      (RoomShape) — early-reflection pattern
  *
  *  Implementation:
- *    - Pre-delay via a short delay line
+ *    - One input ring per channel (processor's AudioArena, power-of-two
+ *      size with room for pre-delay + the longest reflection at
+ *      AudioArena::kMaxSampleRate, so a rate change reuses it).  Each block
+ *      is written once; the pre-delayed late input and every
+ *      early-reflection tap are then contiguous reads from it
+ *    - Early reflections: 8–24 taps (RoomShape), span scaled by revSize,
+ *      read after the pre-delay.  Tap delays are fractional (linear
+ *      interpolation) and glide across the block when size or pre-delay
+ *      move, so a sweep has no zipper steps.  A steady tap is two vector
+ *      multiply-adds over the block (contiguous reads, no gather).  A
+ *      revRoom change crossfades the old tap set out and the new one in
+ *      (equal power, kEarlyFadeSec).  The sum is added to Freeverb's output
+ *      with a ramped gain (revEarly × level, 0 while frozen)
  *    - Reverb via JUCE's built-in Reverb (Freeverb)
+ *    - Freeverb parameters are only re-applied when size / damping / width
+ *      move (CachedParam): setParameters() restarts Freeverb's internal
+ *      damping and room-size smoothers, so re-sending unchanged values
+ *      every block costs CPU for nothing
+ *    - The wet level goes to Freeverb's own (smoothed) wet gain, so the
+ *      parallel return level costs no extra pass
+ *    - Frozen loop (setFreezeLoop, global freezeLoop): once frozen and
+ *      settled, kLoopSec of the tail is captured into an arena buffer, its
+ *      head crossfaded with the kLoopFadeSec that followed so the wrap is
+ *      seamless, and the loop replaces Freeverb (equal-power crossfades
+ *      in and out).  A frozen pad then costs a buffer read per sample.
+ *      A width / level change while frozen re-captures the loop.
  *
  *  Lane A — DSP modules (Source/DSP/*)
  */
@@ -32,25 +161,93 @@ public:
 
         reverb.prepare (spec);
 
-        // Pre-delay buffer: max 200ms
-        int maxPreDelaySamples = static_cast<int> (sampleRate * 0.2) + 1;
-        for (int ch = 0; ch < 2; ++ch)
-        {
-            preDelayBuffer[ch].resize (static_cast<size_t> (maxPreDelaySamples), 0.0f);
-            preDelayWritePos[ch] = 0;
-        }
+        size_.invalidate();
+        damping_.invalidate();
+        width_.invalidate();
+        level_.invalidate();
+        frozen_ = false;
+
+        loopLength_ = static_cast<int> (sampleRate * kLoopSec);
+        loopFade_   = std::max (1, static_cast<int> (sampleRate * kLoopFadeSec));
+        loopState_  = LoopState::off;
+
+        // Input ring: pre-delay (max 200 ms) + reflections + one block
+        // (memory assigned in assignBuffers)
+        maxBlockSize_ = static_cast<int> (spec.maximumBlockSize);
+        ringSize_     = ringSizeFor (AudioArena::capacityRate (sampleRate), maxBlockSize_);
+        ringWritePos_ = 0;
 
         preDelaySamples = 0;
+        earlyShape_      = -1;
+        earlyFadeLength_ = std::max (1, static_cast<int> (sampleRate * kEarlyFadeSec));
+        earlyFadeLeft_   = 0;
+        earlyGain_       = 0.0f;
+        earlyTarget_     = 0.0f;
+    }
+
+    /** Take the input rings (room for AudioArena::capacityRate), the
+        early-reflection scratch and, if `withLoop`, the frozen loop from the
+        arena (about 3.2 MB at 192 kHz; without it setFreezeLoop has no
+        effect).  Freeverb's comb / allpass buffers are allocated inside
+        juce::dsp::Reverb and can't be moved into the arena. */
+    void assignBuffers (AudioArena& arena, bool withLoop)
+    {
+        for (int ch = 0; ch < 2; ++ch)
+            ring_[ch] = arena.allocate<float> (static_cast<size_t> (ringSize_));
+
+        for (int ch = 0; ch < 2; ++ch)
+            early_[ch] = arena.allocate<float> (static_cast<size_t> (maxBlockSize_));
+
+        // Frozen loop + the crossfade samples captured after it
+        const auto loopCapacity = static_cast<size_t> (AudioArena::capacityRate (sampleRate) * (kLoopSec + kLoopFadeSec)) + 1;
+
+        for (int ch = 0; ch < 2; ++ch)
+            loopBuffer[ch] = withLoop ? arena.allocate<float> (loopCapacity) : nullptr;
+    }
+
+    /**
+     *  New sample rate, buffers already assigned.  The input ring is re-timed
+     *  to the new rate (as DelayModule resamples its lines), so pre-delayed
+     *  input and reflections in flight keep their timing, and freeze stays
+     *  on.  A captured loop was recorded at the old rate: it is dropped and
+     *  captured again if still frozen.  The one unavoidable loss is
+     *  Freeverb's comb / allpass state: juce::dsp::Reverb re-sizes those
+     *  buffers for the rate (inside JUCE, the one allocation left on this
+     *  path), so the late tail restarts.
+     */
+    void changeSampleRate (const juce::dsp::ProcessSpec& spec)
+    {
+        const double oldRate     = sampleRate;
+        const int    oldWritePos = ringWritePos_;
+        const int    ringSize    = ringSize_;   // as assigned; never shrinks here
+        const bool   frozen      = frozen_;
+        const float  earlyGain   = earlyGain_;
+
+        prepare (spec);   // loop state off, tap delays snap to the new rate
+
+        jassert (ringSizeFor (AudioArena::capacityRate (sampleRate), maxBlockSize_) <= ringSize);
+        ringSize_  = ringSize;
+        frozen_    = frozen;
+        earlyGain_ = earlyGain;
+
+        // ringWritePos_ is 0 again: the newest sample ends at ringSize_ - 1
+        for (int ch = 0; ch < 2; ++ch)
+            if (ring_[ch] != nullptr)
+                retimeRing (ring_[ch], ringSize_, oldWritePos, oldRate / sampleRate);
     }
 
     void reset()
     {
         reverb.reset();
         for (int ch = 0; ch < 2; ++ch)
-        {
-            std::fill (preDelayBuffer[ch].begin(), preDelayBuffer[ch].end(), 0.0f);
-            preDelayWritePos[ch] = 0;
-        }
+            if (ring_[ch] != nullptr)
+                std::fill (ring_[ch], ring_[ch] + ringSize_, 0.0f);
+
+        ringWritePos_   = 0;
+        earlyShape_     = -1;   // tap delays restart on target
+        earlyFadeLeft_  = 0;
+        earlyGain_      = 0.0f;
+        loopState_      = LoopState::off;
     }
 
     /**
@@ -58,65 +255,553 @@ public:
      *  @param damping01    0..1 damping (from Params::ID::revDamp)
      *  @param preDelayMs   0..200 pre-delay in ms (from Params::ID::revPreDelay)
      *  @param width01      0..1 stereo width (from Params::ID::revWidth)
+     *  @param level01      0..1 wet level (from Params::ID::revLevel)
+     *  @param frozen       freeze the tail (from Params::ID::revFreeze)
+     *  @param early01      0..1 early-reflection level (from Params::ID::revEarly)
+     *  @param roomShape    RoomShape index (from Params::ID::revRoom)
      */
-    void setParameters (float size01, float damping01, float preDelayMs, float width01)
+    void setParameters (float size01, float damping01, float preDelayMs, float width01, float level01 = 1.0f,
+                        bool frozen = false, float early01 = 0.0f, int roomShape = 0)
     {
-        juce::dsp::Reverb::Parameters params;
-        params.roomSize   = size01;
-        params.damping    = damping01;
-        params.width      = width01;
-        params.wetLevel   = 1.0f;   // We handle dry/wet mix externally
-        params.dryLevel   = 0.0f;   // Pure wet signal from reverb
-        params.freezeMode = 0.0f;
-        reverb.setParameters (params);
+        // Evaluate all four: each cache must take its new value
+        const bool sizeChanged    = size_.update (size01, kParamEpsilon);
+        const bool dampingChanged = damping_.update (damping01, kParamEpsilon);
+        const bool widthChanged   = width_.update (width01, kParamEpsilon);
+        const bool levelChanged   = level_.update (level01, kParamEpsilon);
+        const bool freezeChanged  = frozen != frozen_;
+        frozen_ = frozen;
+
+        // Frozen, the output still depends on width and level: a captured
+        // loop no longer matches, so it is captured again
+        if (frozen && (widthChanged || levelChanged))
+            loopStale_ = true;
 
-        // Pre-delay in samples
-        preDelaySamples = static_cast<int> (preDelayMs * 0.001 * sampleRate);
-        int maxSamples = static_cast<int> (preDelayBuffer[0].size()) - 1;
-        preDelaySamples = std::clamp (preDelaySamples, 0, maxSamples);
+        if (sizeChanged || dampingChanged || widthChanged || levelChanged || freezeChanged)
+        {
+            juce::dsp::Reverb::Parameters params;
+            params.roomSize   = size01;
+            params.damping    = damping01;
+            params.width      = width01;
+            params.wetLevel   = level01; // We handle dry/wet mix externally
+            params.dryLevel   = 0.0f;   // Pure wet signal from reverb
+            params.freezeMode = frozen ? 1.0f : 0.0f;
+            reverb.setParameters (params);
+        }
+
+        // Pre-delay in samples: whole for the late input, fractional for the
+        // reflections
+        const double preDelay = std::clamp (preDelayMs * 0.001 * sampleRate, 0.0, kMaxPreDelaySec * sampleRate);
+        preDelaySamples = static_cast<int> (preDelay);
+
+        // Early reflections: process() glides the tap delays to these and
+        // crossfades to a new shape
+        earlyRequest_  = std::clamp (roomShape, 0, static_cast<int> (RoomShape::kCount) - 1);
+        earlyPreDelay_ = static_cast<float> (preDelay);
+        earlySpan_     = static_cast<float> (0.001 * sampleRate * (0.25 + 0.75 * static_cast<double> (size01)));
+
+        // Reflections are input, so a frozen tail has none
+        earlyTarget_ = frozen ? 0.0f : std::clamp (early01, 0.0f, 1.0f) * level01;
+    }
+
+    /** Play a captured loop instead of Freeverb while frozen (global freezeLoop). */
+    void setFreezeLoop (bool enabled) noexcept
+    {
+        loopEnabled_ = enabled;
     }
 
     void process (juce::dsp::AudioBlock<float>& block)
     {
-        // Apply pre-delay if needed
-        if (preDelaySamples > 0)
+        const int numSamples  = static_cast<int> (block.getNumSamples());
+        const auto channels   = std::min (block.getNumChannels(), static_cast<size_t> (2));
+        jassert (numSamples <= maxBlockSize_);
+
+        // Input into the ring, then reflections and the pre-delayed late
+        // input read back from it (reads may reach into this block)
+        const bool early = earlyGain_ > 0.0f || earlyTarget_ > 0.0f;
+        updateEarlyShape (early);
+
+        for (size_t ch = 0; ch < channels; ++ch)
         {
-            for (size_t ch = 0; ch < block.getNumChannels() && ch < 2; ++ch)
+            auto* data = block.getChannelPointer (ch);
+            writeRing (ch, data, numSamples);
+
+            if (early)
             {
-                auto* data = block.getChannelPointer (ch);
-                for (size_t s = 0; s < block.getNumSamples(); ++s)
-                {
-                    // Write current sample
-                    preDelayBuffer[ch][static_cast<size_t> (preDelayWritePos[ch])] = data[s];
-
-                    // Read delayed sample
-                    int readPos = preDelayWritePos[ch] - preDelaySamples;
-                    if (readPos < 0)
-                        readPos += static_cast<int> (preDelayBuffer[ch].size());
-                    data[s] = preDelayBuffer[ch][static_cast<size_t> (readPos)];
-
-                    // Advance
-                    preDelayWritePos[ch]++;
-                    if (preDelayWritePos[ch] >= static_cast<int> (preDelayBuffer[ch].size()))
-                        preDelayWritePos[ch] = 0;
-                }
+                std::fill (early_[ch], early_[ch] + numSamples, 0.0f);
+                readEarly (ch, numSamples);
+            }
+
+            if (preDelaySamples > 0)
+            {
+                std::fill (data, data + numSamples, 0.0f);
+                readRing (ch, preDelaySamples, data, numSamples, 1.0f);
             }
         }
 
+        ringWritePos_  = (ringWritePos_ + numSamples) & (ringSize_ - 1);
+        earlyFadeLeft_ = std::max (0, earlyFadeLeft_ - numSamples);
+
+        updateLoopState();
+
+        // Looping: the frozen tail comes from the loop buffer, Freeverb idles
+        // (no reflections while frozen)
+        if (loopState_ == LoopState::looping)
+        {
+            playLoop (block);
+            earlyGain_ = earlyTarget_;
+            return;
+        }
+
         // Process through reverb
         juce::dsp::ProcessContextReplacing<float> context (block);
         reverb.process (context);
+
+        switch (loopState_)
+        {
+            case LoopState::settling:  loopCount_ -= static_cast<int> (block.getNumSamples()); break;
+            case LoopState::capturing: captureLoop (block); break;
+            case LoopState::entering:  crossfadeLoop (block, true); break;
+            case LoopState::leaving:   crossfadeLoop (block, false); break;
+            default: break;
+        }
+
+        // Early reflections on top of the late tail (gain ramped per block)
+        if (early)
+        {
+            const float inc = (earlyTarget_ - earlyGain_) / static_cast<float> (std::max (1, numSamples));
+
+            for (size_t ch = 0; ch < channels; ++ch)
+            {
+                auto* data = block.getChannelPointer (ch);
+
+                if (inc == 0.0f)
+                {
+                    juce::FloatVectorOperations::addWithMultiply (data, early_[ch], earlyGain_, numSamples);
+                }
+                else
+                {
+                    for (int i = 0; i < numSamples; ++i)
+                        data[i] += (earlyGain_ + inc * static_cast<float> (i + 1)) * early_[ch][i];
+                }
+            }
+
+            earlyGain_ = earlyTarget_;
+        }
     }
 
 private:
+    static constexpr double kMaxPreDelaySec = 0.2;
+    static constexpr double kEarlyFadeSec   = 0.03;   // revRoom tap-set crossfade
+
+    /** Power-of-two ring for the longest pre-delay + reflection (and the
+        sample after it, for interpolation), plus one block. */
+    static int ringSizeFor (double rate, int maxBlockSize) noexcept
+    {
+        const int needed = static_cast<int> (rate * (kMaxPreDelaySec + EarlyReflections::kMaxSpanMs * 0.001))
+                         + maxBlockSize + 2;
+        return juce::nextPowerOfTwo (needed);
+    }
+
+    /**
+     *  Re-time a ring in place for a new sample rate (`ratio` = old / new
+     *  rate, linear interpolation), like DelayModule::resampleLine.  The ring
+     *  is rotated so the newest sample sits at size - 1, just behind the next
+     *  write at 0; each sample then takes the old value of the same age, and
+     *  silence past the oldest.  Lowering the rate fills from the end and
+     *  raising it from the start, so every read is ahead of the writes.
+     */
+    static void retimeRing (float* ring, int size, int writePos, double ratio) noexcept
+    {
+        std::rotate (ring, ring + writePos, ring + size);
+
+        if (ratio == 1.0 || size < 2)
+            return;
+
+        auto sampleAt = [ring, ratio, size] (int j)
+        {
+            const double pos = (size - 1) - (size - 1 - j) * ratio;
+            if (pos < 0.0)
+                return 0.0f;
+
+            const int   i0   = static_cast<int> (pos);
+            const int   i1   = std::min (i0 + 1, size - 1);
+            const float frac = static_cast<float> (pos - i0);
+            return ring[i0] + frac * (ring[i1] - ring[i0]);
+        };
+
+        if (ratio > 1.0)
+            for (int j = size - 1; j >= 0; --j)
+                ring[j] = sampleAt (j);
+        else
+            for (int j = 0; j < size; ++j)
+                ring[j] = sampleAt (j);
+    }
+
+    /** Tap delay in samples for the current size and pre-delay. */
+    float earlyTapDelay (const EarlyReflections::Shape& shape, size_t ch, int k) const noexcept
+    {
+        const auto& tap = shape.taps[static_cast<size_t> (k)];
+        return earlyPreDelay_ + std::max (1.0f, (ch == 0 ? tap.timeL : tap.timeR) * shape.spanMs * earlySpan_);
+    }
+
+    /** Put the live set's taps on their targets (no glide). */
+    void snapEarlyDelays() noexcept
+    {
+        const auto& shape = EarlyReflections::shapes[static_cast<size_t> (earlyShape_)];
+
+        for (size_t ch = 0; ch < 2; ++ch)
+            for (int k = 0; k < shape.numTaps; ++k)
+                earlyDelay_[ch][k] = earlyTapDelay (shape, ch, k);
+    }
+
+    /**
+     *  Take a new revRoom shape.  With reflections audible the old tap set
+     *  keeps its delays and fades out while the new one fades in from its
+     *  target delays; a change during a fade waits for it to finish.
+     *  Silent, or on the first block, the taps just follow their targets.
+     */
+    void updateEarlyShape (bool audible) noexcept
+    {
+        if (! audible || earlyShape_ < 0)
+        {
+            earlyFadeLeft_ = 0;
+            earlyShape_    = earlyRequest_;
+            snapEarlyDelays();
+            return;
+        }
+
+        if (earlyRequest_ == earlyShape_ || earlyFadeLeft_ > 0)
+            return;
+
+        earlyOldShape_ = earlyShape_;
+        std::copy (&earlyDelay_[0][0], &earlyDelay_[0][0] + 2 * EarlyReflections::kMaxTaps, &earlyOldDelay_[0][0]);
+
+        earlyShape_    = earlyRequest_;
+        earlyFadeLeft_ = earlyFadeLength_;
+        snapEarlyDelays();
+    }
+
+    /** early_[ch] += this block's reflections (both tap sets during a revRoom fade). */
+    void readEarly (size_t ch, int numSamples) noexcept
+    {
+        // Equal-power fade position at the start / end of the block (1 = new set only)
+        float fadeIn[2] = { 1.0f, 1.0f }, fadeOut[2] = { 0.0f, 0.0f };
+
+        if (earlyFadeLeft_ > 0)
+        {
+            const int left[2] = { earlyFadeLeft_, std::max (0, earlyFadeLeft_ - numSamples) };
+
+            for (int e = 0; e < 2; ++e)
+            {
+                const float x = juce::MathConstants<float>::halfPi
+                              * (1.0f - static_cast<float> (left[e]) / static_cast<float> (earlyFadeLength_));
+                fadeIn[e]  = std::sin (x);
+                fadeOut[e] = std::cos (x);
+            }
+        }
+
+        // Live set: each tap glides from its current delay to the target
+        const auto& shape = EarlyReflections::shapes[static_cast<size_t> (earlyShape_)];
+
+        for (int k = 0; k < shape.numTaps; ++k)
+        {
+            const float gain  = shape.taps[static_cast<size_t> (k)].gain;
+            const float start = earlyDelay_[ch][k];
+            const float end   = earlyTapDelay (shape, ch, k);
+
+            readTap (ch, start, end, early_[ch], numSamples, gain * fadeIn[0], gain * fadeIn[1]);
+            earlyDelay_[ch][k] = end;
+        }
+
+        // Outgoing set: frozen delays, fading out
+        if (earlyFadeLeft_ > 0)
+        {
+            const auto& old = EarlyReflections::shapes[static_cast<size_t> (earlyOldShape_)];
+
+            for (int k = 0; k < old.numTaps; ++k)
+            {
+                const float gain  = old.taps[static_cast<size_t> (k)].gain;
+                const float delay = earlyOldDelay_[ch][k];
+                readTap (ch, delay, delay, early_[ch], numSamples, gain * fadeOut[0], gain * fadeOut[1]);
+            }
+        }
+    }
+
+    /**
+     *  dest += gain · the input `delay` samples ago, linearly interpolated.
+     *  Delay and gain ramp from start to end across the block; when both
+     *  hold, the read is two contiguous multiply-adds (whole and whole + 1).
+     */
+    void readTap (size_t ch, float delayStart, float delayEnd, float* dest, int numSamples,
+                  float gainStart, float gainEnd) noexcept
+    {
+        if (delayStart == delayEnd && gainStart == gainEnd)
+        {
+            const int   whole = static_cast<int> (delayStart);
+            const float frac  = delayStart - static_cast<float> (whole);
+
+            readRing (ch, whole, dest, numSamples, gainStart * (1.0f - frac));
+            if (frac > 0.0f)
+                readRing (ch, whole + 1, dest, numSamples, gainStart * frac);
+
+            return;
+        }
+
+        const float inv      = 1.0f / static_cast<float> (std::max (1, numSamples));
+        const float delayInc = (delayEnd - delayStart) * inv;
+        const float gainInc  = (gainEnd - gainStart) * inv;
+        const int   mask     = ringSize_ - 1;
+        const float* ring    = ring_[ch];
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float step  = static_cast<float> (i + 1);
+            const float delay = delayStart + delayInc * step;
+            const int   whole = static_cast<int> (delay);
+            const float frac  = delay - static_cast<float> (whole);
+
+            const int   pos = (ringWritePos_ + i - whole) & mask;
+            const float x0  = ring[pos];
+            const float x1  = ring[(pos - 1) & mask];
+
+            dest[i] += (gainStart + gainInc * step) * (x0 + frac * (x1 - x0));
+        }
+    }
+
+    /** Append one block of input to channel `ch`'s ring (at ringWritePos_). */
+    void writeRing (size_t ch, const float* src, int numSamples) noexcept
+    {
+        const int first = std::min (numSamples, ringSize_ - ringWritePos_);
+        std::copy (src, src + first, ring_[ch] + ringWritePos_);
+        std::copy (src + first, src + numSamples, ring_[ch]);
+    }
+
+    /** dest += gain · the block's input `offset` samples ago (two contiguous spans). */
+    void readRing (size_t ch, int offset, float* dest, int numSamples, float gain) noexcept
+    {
+        const int start = (ringWritePos_ - offset) & (ringSize_ - 1);
+        const int first = std::min (numSamples, ringSize_ - start);
+
+        juce::FloatVectorOperations::addWithMultiply (dest, ring_[ch] + start, gain, first);
+        if (first < numSamples)
+            juce::FloatVectorOperations::addWithMultiply (dest + first, ring_[ch], gain, numSamples - first);
+    }
+
+    // ── Frozen loop ─────────────────────────────────────────────────────
+    //   off → settling (tail settles) → capturing → entering (Freeverb → loop)
+    //   → looping; unfreeze / stale → leaving (loop → Freeverb) → off
+    enum class LoopState { off, settling, capturing, entering, looping, leaving };
+
+    static constexpr double kLoopSec     = 2.0;    // loop length
+    static constexpr double kLoopFadeSec = 0.1;    // wrap + Freeverb ↔ loop crossfades
+    static constexpr double kSettleSec   = 0.25;   // after freezing, before capture
+
+    /** State transitions, at block boundaries (one control block at most). */
+    void updateLoopState() noexcept
+    {
+        const bool wantLoop = frozen_ && loopEnabled_ && ! loopStale_ && loopBuffer[0] != nullptr;
+
+        switch (loopState_)
+        {
+            case LoopState::off:
+                loopStale_ = false;
+                if (frozen_ && loopEnabled_ && loopBuffer[0] != nullptr)
+                {
+                    loopState_ = LoopState::settling;
+                    loopCount_ = static_cast<int> (sampleRate * kSettleSec);
+                }
+                break;
+
+            case LoopState::settling:
+                if (! wantLoop)
+                    loopState_ = LoopState::off;
+                else if (loopCount_ <= 0)
+                    loopState_ = LoopState::capturing;   // loopCount_ = samples captured
+                break;
+
+            case LoopState::capturing:
+                if (! wantLoop)
+                    loopState_ = LoopState::off;
+                else if (loopCount_ >= loopLength_ + loopFade_)
+                {
+                    bakeLoop();
+                    loopState_ = LoopState::entering;
+                    loopPos_   = 0;
+                    fadePos_   = 0;
+                }
+                break;
+
+            case LoopState::entering:
+                if (! wantLoop)
+                {
+                    loopState_ = LoopState::leaving;
+                    fadePos_   = loopFade_ - fadePos_;
+                }
+                else if (fadePos_ >= loopFade_)
+                    loopState_ = LoopState::looping;
+                break;
+
+            case LoopState::looping:
+                if (! wantLoop)
+                {
+                    loopState_ = LoopState::leaving;
+                    fadePos_   = 0;
+                }
+                break;
+
+            case LoopState::leaving:
+                if (fadePos_ >= loopFade_)
+                    loopState_ = LoopState::off;
+                break;
+        }
+    }
+
+    /** Capturing: record Freeverb's output (loop, then the fade samples after it). */
+    void captureLoop (const juce::dsp::AudioBlock<float>& block) noexcept
+    {
+        const int total = loopLength_ + loopFade_;
+        const int n = std::min (static_cast<int> (block.getNumSamples()), total - loopCount_);
+
+        for (size_t ch = 0; ch < block.getNumChannels() && ch < 2; ++ch)
+            std::copy (block.getChannelPointer (ch), block.getChannelPointer (ch) + n, loopBuffer[ch] + loopCount_);
+
+        loopCount_ += n;
+    }
+
+    /**
+     *  Make the wrap seamless: the loop is samples [0, L), and the F samples
+     *  captured after it continue its end.  Fading the head from those into
+     *  the original head makes loop[0] follow loop[L - 1]:
+     *
+     *      loop[i] = c[i] · sin θ + c[L + i] · cos θ,   θ = π/2 · i / F
+     */
+    void bakeLoop() noexcept
+    {
+        const float delta = juce::MathConstants<float>::halfPi / static_cast<float> (loopFade_);
+        const float cd = std::cos (delta), sd = std::sin (delta);
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            float* loop = loopBuffer[ch];
+            float c = 1.0f, s = 0.0f;   // cos θ, sin θ (rotation recurrence)
+
+            for (int i = 0; i < loopFade_; ++i)
+            {
+                loop[i] = loop[i] * s + loop[loopLength_ + i] * c;
+
+                const float cn = c * cd - s * sd;
+                s = s * cd + c * sd;
+                c = cn;
+            }
+        }
+    }
+
+    /** Looping: read the loop buffer (Freeverb not run). */
+    void playLoop (juce::dsp::AudioBlock<float>& block) noexcept
+    {
+        const int numSamples = static_cast<int> (block.getNumSamples());
+        int pos = loopPos_;
+
+        for (size_t ch = 0; ch < block.getNumChannels() && ch < 2; ++ch)
+        {
+            auto* data = block.getChannelPointer (ch);
+            pos = loopPos_;
+
+            for (int done = 0; done < numSamples;)
+            {
+                const int n = std::min (numSamples - done, loopLength_ - pos);
+                std::copy (loopBuffer[ch] + pos, loopBuffer[ch] + pos + n, data + done);
+
+                done += n;
+                pos  += n;
+                if (pos >= loopLength_)
+                    pos = 0;
+            }
+        }
+
+        loopPos_ = pos;
+    }
+
+    /** Equal-power crossfade between Freeverb's output (in `block`) and the loop. */
+    void crossfadeLoop (juce::dsp::AudioBlock<float>& block, bool toLoop) noexcept
+    {
+        const int numSamples = static_cast<int> (block.getNumSamples());
+        const float delta = juce::MathConstants<float>::halfPi / static_cast<float> (loopFade_);
+        const float cd = std::cos (delta), sd = std::sin (delta);
+        const float theta0 = delta * static_cast<float> (std::min (fadePos_, loopFade_));
+
+        int pos = loopPos_;
+
+        for (size_t ch = 0; ch < block.getNumChannels() && ch < 2; ++ch)
+        {
+            auto* data = block.getChannelPointer (ch);
+            float c = std::cos (theta0), s = std::sin (theta0);
+            int fade = fadePos_;
+            pos = loopPos_;
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                // θ runs 0 → π/2 over the fade: toward the loop, or back to Freeverb
+                const float loopGain = fade < loopFade_ ? (toLoop ? s : c) : (toLoop ? 1.0f : 0.0f);
+                const float liveGain = fade < loopFade_ ? (toLoop ? c : s) : (toLoop ? 0.0f : 1.0f);
+
+                data[i] = data[i] * liveGain + loopBuffer[ch][pos] * loopGain;
+
+                if (++pos >= loopLength_)
+                    pos = 0;
+
+                if (fade < loopFade_)
+                {
+                    ++fade;
+                    const float cn = c * cd - s * sd;
+                    s = s * cd + c * sd;
+                    c = cn;
+                }
+            }
+        }
+
+        loopPos_ = pos;
+        fadePos_ = std::min (fadePos_ + numSamples, loopFade_);
+    }
+
     double sampleRate = 44100.0;
     int numChannels = 2;
 
     juce::dsp::Reverb reverb;
 
-    // Pre-delay
-    std::vector<float> preDelayBuffer[2];
-    int preDelayWritePos[2] = { 0, 0 };
+    // Last values sent to Freeverb
+    static constexpr float kParamEpsilon = 1.0e-5f;
+    CachedParam size_, damping_, width_, level_;
+
+    // Input ring (pre-delay + early reflections)
+    float* ring_[2] = { nullptr, nullptr };   // ringSize_ samples each (arena)
+    int ringSize_     = 1;                    // power of two
+    int ringWritePos_ = 0;
+    int maxBlockSize_ = 0;
     int preDelaySamples = 0;
+
+    // Early reflections
+    float* early_[2] = { nullptr, nullptr };  // per-block tap sum (arena, maxBlockSize_)
+    float earlyDelay_[2][EarlyReflections::kMaxTaps] {};      // live set: pre-delay + tap time, samples
+    float earlyOldDelay_[2][EarlyReflections::kMaxTaps] {};   // outgoing set during a revRoom fade
+    float earlyPreDelay_ = 0.0f;              // fractional pre-delay, samples
+    float earlySpan_     = 0.0f;              // samples per ms of a shape's span (size-scaled)
+    int earlyShape_      = -1;                // live set (-1: snap to earlyRequest_)
+    int earlyOldShape_   = 0;
+    int earlyRequest_    = 0;                 // from setParameters
+    int earlyFadeLength_ = 1, earlyFadeLeft_ = 0;
+    float earlyGain_     = 0.0f;              // applied at the end of the last block
+    float earlyTarget_   = 0.0f;
+
+    // Freeze + frozen loop
+    bool frozen_      = false;
+    bool loopEnabled_ = false;
+    bool loopStale_   = false;                          // width / level moved while frozen
+    LoopState loopState_ = LoopState::off;
+    float* loopBuffer[2] = { nullptr, nullptr };        // loopLength_ + loopFade_ samples each (arena; null unless reserved)
+    int loopLength_ = 0, loopFade_ = 1;
+    int loopCount_  = 0;                                // settling: samples left; capturing: samples captured
+    int loopPos_    = 0;                                // playback position
+    int fadePos_    = 0;                                // samples into the current crossfade
 };
 
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "AudioArena.h"
+
+/**
+ *  StereoDiffuser — Series allpass chain for smearing a stereo signal
+ *
+ *  Four Schroeder allpasses in series (Freeverb lengths: 556 / 441 / 341 /
+ *  225 samples at 44.1 kHz, scaled to the sample rate).  L and R run
+ *  together in one SIMD register:
+ *
+ *      lane 0 = L    lane 1 = R    (remaining lanes unused)
+ *
+ *  so each stage costs one register load / store and two multiply-adds per
+ *  sample for both channels.
+ *
+ *  Per stage:  w[n] = x[n] + g·w[n-D],   y[n] = w[n-D] - g·w[n]
+ *
+ *  Used inside DelayModule's feedback loop, so every repeat is smeared a
+ *  little more than the one before.  Stage memory comes from the owner's
+ *  AudioArena (assignBuffers) after prepare().
+ *
+ *  Lane A — DSP modules (Source/DSP/*)
+ */
+class StereoDiffuser
+{
+public:
+    static constexpr int kNumStages = 4;
+
+    StereoDiffuser() = default;
+
+    void prepare (double sampleRate)
+    {
+        sampleRate_ = sampleRate;
+
+        for (int k = 0; k < kNumStages; ++k)
+        {
+            auto& st = stages_[k];
+            st.length = stageLength (k, sampleRate);
+            st.pos = 0;
+        }
+    }
+
+    /** Take the stage memory from the arena (room for AudioArena::capacityRate). */
+    void assignBuffers (AudioArena& arena)
+    {
+        const double rate = AudioArena::capacityRate (sampleRate_);
+
+        for (int k = 0; k < kNumStages; ++k)
+            stages_[k].buffer = arena.allocate<Vec> (static_cast<size_t> (stageLength (k, rate)));
+    }
+
+    void reset()
+    {
+        for (auto& st : stages_)
+        {
+            std::fill (st.buffer, st.buffer + st.length, Vec::expand (0.0f));
+            st.pos = 0;
+        }
+    }
+
+    /** Copy another prepared diffuser's state (same sample rate, no allocation). */
+    void copyStateFrom (const StereoDiffuser& other)
+    {
+        for (int k = 0; k < kNumStages; ++k)
+        {
+            std::copy (other.stages_[k].buffer, other.stages_[k].buffer + other.stages_[k].length,
+                       stages_[k].buffer);
+            stages_[k].pos = other.stages_[k].pos;
+        }
+    }
+
+    /**
+     *  Run one stereo frame through the chain, in place.
+     *  @param g  allpass coefficient (0 = pure delay, keep below ~0.75)
+     */
+    void process (float (&frame)[2], float g) noexcept
+    {
+        alignas (Vec::SIMDRegisterSize) float raw[Vec::SIMDNumElements] {};
+        raw[0] = frame[0];
+        raw[1] = frame[1];
+
+        auto x = Vec::fromRawArray (raw);
+        const auto gain = Vec::expand (g);
+
+        for (auto& st : stages_)
+        {
+            auto& slot = st.buffer[static_cast<size_t> (st.pos)];
+            const auto delayed = slot;
+            const auto w = x + gain * delayed;
+
+            slot = w;
+            x = delayed - gain * w;
+
+            if (++st.pos >= st.length)
+                st.pos = 0;
+        }
+
+        x.copyToRawArray (raw);
+        frame[0] = raw[0];
+        frame[1] = raw[1];
+    }
+
+private:
+    using Vec = juce::dsp::SIMDRegister<float>;
+    static_assert (Vec::SIMDNumElements >= 2, "StereoDiffuser packs L/R per register");
+
+    struct Stage
+    {
+        Vec* buffer = nullptr;     // one L/R frame per slot (arena)
+        int length = 1;
+        int pos    = 0;
+    };
+
+    static int stageLength (int stage, double sampleRate) noexcept
+    {
+        static constexpr int kLengths44k[kNumStages] = { 556, 441, 341, 225 };
+        return std::max (1, static_cast<int> (kLengths44k[stage] * sampleRate / 44100.0));
+    }
+
+    Stage stages_[kNumStages];
+    double sampleRate_ = 44100.0;
+};
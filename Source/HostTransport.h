@@ -0,0 +1,97 @@
+#pragma once
+
+/**
+ * ============================================================================
+ *  MacroMorphFX — Host Transport Snapshot
+ * ============================================================================
+ *
+ *  Reads the host playhead once per block and caches the result, so nothing
+ *  else in the plugin calls getPlayHead() / getPosition().
+ *
+ *    - bpm:        host tempo, or the last known tempo if the host doesn't
+ *                  report one (120 until the first report)
+ *    - ppq:        host ppqPosition while the transport runs; otherwise a
+ *                  free-running beat position advanced at the current tempo,
+ *                  so tempo-synced modules always have a musical timeline
+ *    - isPlaying:  host transport state
+ *
+ *  JUCE has no "position changed" notification, so the playhead is polled
+ *  once per block; consumers key their own recomputation off the snapshot
+ *  (e.g. the delay only adds a tempo segment when the tempo changes).
+ *
+ *  Lane B — Params + smoothing + state
+ * ============================================================================
+ */
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+struct TransportSnapshot
+{
+    double bpm            = 120.0;
+    double ppq            = 0.0;     // beat position at the first sample of the block
+    double beatsPerSample = 0.0;
+    bool   isPlaying      = false;
+
+    /** Beat position `offset` samples into the block. */
+    double ppqAt (int offset) const noexcept   { return ppq + offset * beatsPerSample; }
+
+    /** The same snapshot for a block starting `offset` samples later (may be negative). */
+    TransportSnapshot shiftedBy (int offset) const noexcept
+    {
+        auto shifted = *this;
+        shifted.ppq = ppqAt (offset);
+        return shifted;
+    }
+};
+
+class HostTransport
+{
+public:
+    void prepare (double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        freeRunPpq_ = 0.0;
+        snapshot_ = {};
+        snapshot_.beatsPerSample = snapshot_.bpm / (60.0 * sampleRate);
+    }
+
+    /** Call once at the top of processBlock. */
+    const TransportSnapshot& update (juce::AudioPlayHead* playHead, int numSamples)
+    {
+        bool hasHostPpq = false;
+
+        snapshot_.isPlaying = false;
+
+        if (playHead != nullptr)
+        {
+            if (const auto pos = playHead->getPosition(); pos.hasValue())
+            {
+                if (const auto bpm = pos->getBpm(); bpm.hasValue() && *bpm > 20.0)
+                    snapshot_.bpm = *bpm;
+
+                snapshot_.isPlaying = pos->getIsPlaying();
+
+                if (const auto ppq = pos->getPpqPosition(); snapshot_.isPlaying && ppq.hasValue())
+                {
+                    snapshot_.ppq = *ppq;
+                    hasHostPpq = true;
+                }
+            }
+        }
+
+        snapshot_.beatsPerSample = snapshot_.bpm / (60.0 * sampleRate);
+
+        if (! hasHostPpq)
+            snapshot_.ppq = freeRunPpq_;
+
+        freeRunPpq_ = snapshot_.ppqAt (numSamples);
+        return snapshot_;
+    }
+
+    const TransportSnapshot& get() const noexcept   { return snapshot_; }
+
+private:
+    double sampleRate = 44100.0;
+    double freeRunPpq_ = 0.0;
+    TransportSnapshot snapshot_;
+};
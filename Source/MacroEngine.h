@@ -105,7 +105,7 @@ public:
      *      offset = macroValue * mapping.amount * (paramMax - paramMin)
      *
      *  The result is clamped to the parameter's valid range.
-     *  Discrete parameters (filtMode, delaySync, delayPingPong) are skipped.
+     *  Discrete parameters (filtMode, driveCurve, crushDither, delaySync, delayPingPong, delayMode, revFreeze, revRoom, M/S routes) are skipped.
      */
     void apply (SceneParams& params, const float macroValues[kNumMacros]) const
     {
@@ -0,0 +1,99 @@
+#pragma once
+
+/**
+ * ============================================================================
+ *  MacroMorphFX — MIDI Performance Mapping
+ * ============================================================================
+ *
+ *  Turns incoming MIDI into performance-param events (ParamEvents.h) at the
+ *  message's sample offset, so footswitch / controller scene changes land
+ *  on their exact sample:
+ *
+ *    - Note on  C3..G3 (60..67)   → Scene A 1..8
+ *    - Note on  C4..G4 (72..79)   → Scene B 1..8
+ *    - CC 1  (mod wheel)          → Morph
+ *    - CC 16..19                  → Macro 1..4
+ *    - CC 20 / 21                 → Morph X / Morph Y
+ *    - Program change 0..8        → Factory preset (loaded on the message
+ *                                   thread, not sample-accurate)
+ *
+ *  Messages are filtered by the midiChannel param (0 = omni, 1..16).
+ *
+ *  Lane D — Scenes/Morph/Macros
+ * ============================================================================
+ */
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "ParamEvents.h"
+#include "SceneData.h"
+
+namespace MidiMapping
+{
+    static constexpr int kSceneANoteBase = 60;   // C3 (JUCE / Ableton octave numbering)
+    static constexpr int kSceneBNoteBase = 72;   // C4
+
+    static constexpr int kMorphCC  = 1;
+    static constexpr int kMacroCC[4] = { 16, 17, 18, 19 };
+    static constexpr int kMorphXCC = 20;
+    static constexpr int kMorphYCC = 21;
+
+    /** True if the message should be handled on the given channel setting. */
+    inline bool acceptsChannel (const juce::MidiMessage& msg, int channelSetting)
+    {
+        return channelSetting == 0 || msg.getChannel() == channelSetting;
+    }
+
+    /**
+     *  Map a note-on / CC to a performance-param event.
+     *  @return false if the message isn't mapped
+     */
+    inline bool toEvent (const juce::MidiMessage& msg, int sampleOffset, ParamEvent& out)
+    {
+        out.sampleOffset = sampleOffset;
+
+        if (msg.isNoteOn())
+        {
+            const int note = msg.getNoteNumber();
+
+            if (note >= kSceneANoteBase && note < kSceneANoteBase + kNumScenes)
+            {
+                out.param = PerfParam::sceneA;
+                out.value = static_cast<float> (note - kSceneANoteBase);
+                return true;
+            }
+
+            if (note >= kSceneBNoteBase && note < kSceneBNoteBase + kNumScenes)
+            {
+                out.param = PerfParam::sceneB;
+                out.value = static_cast<float> (note - kSceneBNoteBase);
+                return true;
+            }
+
+            return false;
+        }
+
+        if (msg.isController())
+        {
+            const int   cc    = msg.getControllerNumber();
+            const float value = static_cast<float> (msg.getControllerValue()) / 127.0f;
+
+            out.value = value;
+
+            if (cc == kMorphCC)  { out.param = PerfParam::morph;  return true; }
+            if (cc == kMorphXCC) { out.param = PerfParam::morphX; return true; }
+            if (cc == kMorphYCC) { out.param = PerfParam::morphY; return true; }
+
+            for (int m = 0; m < 4; ++m)
+            {
+                if (cc == kMacroCC[m])
+                {
+                    out.param = PerfParam::macro1 + m;
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+} // namespace MidiMapping
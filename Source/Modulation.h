@@ -0,0 +1,243 @@
+#pragma once
+
+/**
+ * ============================================================================
+ *  MacroMorphFX — Modulation Sources
+ * ============================================================================
+ *
+ *  Internal modulation that drives the performance controls (morph,
+ *  morph X/Y and macro1..macro4) so users don't have to automate them at
+ *  audio-ish rates from the DAW.
+ *
+ *  Sources are evaluated at control rate (once per control block, see
+ *  MacroMorphFXProcessor::kControlBlockSize), never per sample.  Their
+ *  outputs are summed into a ModOffsets struct which the processor adds to
+ *  the APVTS values before the morph + macro pipeline runs.
+ *
+ *  LFOs:
+ *    - 4 LFOs, each with shape / tempo-synced rate / bipolar depth / target
+ *    - Phase is derived from the host ppqPosition while the transport runs,
+ *      so modulation lands on the grid and renders are repeatable
+ *    - Sine uses the shared DspTables wavetable (no std::sin on the audio thread)
+ *    - S&H and smooth-random values are hashed from the cycle index, so the
+ *      "random" pattern is identical on every playback
+ *
+ *  Lane D — Scenes/Morph/Macros
+ * ============================================================================
+ */
+
+#include "MacroEngine.h"
+#include "DSP/DspTables.h"
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// ─── Modulation targets ────────────────────────────────────────────────────
+
+enum class ModTarget
+{
+    off = 0,
+    morph,
+    macro1,
+    macro2,
+    macro3,
+    macro4,
+    morphX,
+    morphY,
+    kCount
+};
+
+static constexpr const char* modTargetNames[] = {
+    "Off", "Morph", "Macro 1", "Macro 2", "Macro 3", "Macro 4", "Morph X", "Morph Y"
+};
+
+/** Summed modulation for one control block (added to the APVTS values). */
+struct ModOffsets
+{
+    float morph = 0.0f;
+    float morphX = 0.0f;
+    float morphY = 0.0f;
+    float macros[MacroEngine::kNumMacros] = {};
+
+    void add (ModTarget target, float amount)
+    {
+        switch (target)
+        {
+            case ModTarget::morph:   morph     += amount; break;
+            case ModTarget::macro1:  macros[0] += amount; break;
+            case ModTarget::macro2:  macros[1] += amount; break;
+            case ModTarget::macro3:  macros[2] += amount; break;
+            case ModTarget::macro4:  macros[3] += amount; break;
+            case ModTarget::morphX:  morphX    += amount; break;
+            case ModTarget::morphY:  morphY    += amount; break;
+            case ModTarget::off:
+            case ModTarget::kCount:
+            default:                 break;
+        }
+    }
+};
+
+// ─── LFO shapes + rates ────────────────────────────────────────────────────
+
+enum class LfoShape
+{
+    sine = 0,
+    triangle,
+    saw,
+    sampleHold,
+    randomSmooth,
+    kCount
+};
+
+static constexpr const char* lfoShapeNames[] = {
+    "Sine", "Triangle", "Saw", "S&H", "Smooth Rnd"
+};
+
+/** Cycle length in beats for each rate choice (tempo-synced). */
+static constexpr int kNumLfoRates = 8;
+
+static constexpr double lfoRateBeats[kNumLfoRates] = {
+    0.25,   // 1/16
+    0.5,    // 1/8
+    1.0,    // 1/4
+    2.0,    // 1/2
+    4.0,    // 1 bar
+    8.0,    // 2 bars
+    16.0,   // 4 bars
+    32.0    // 8 bars
+};
+
+static constexpr const char* lfoRateNames[kNumLfoRates] = {
+    "1/16", "1/8", "1/4", "1/2", "1 Bar", "2 Bars", "4 Bars", "8 Bars"
+};
+
+// ─── LFO bank ──────────────────────────────────────────────────────────────
+
+class LfoBank
+{
+public:
+    static constexpr int kNumLfos = 4;
+
+    LfoBank() = default;
+
+    void prepare (double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        reset();
+    }
+
+    void reset()
+    {
+        beatPos_ = 0.0;
+    }
+
+    /** Configure one LFO (call once per block from the APVTS values). */
+    void setLfo (int index, LfoShape shape, int rateIndex, float depth, ModTarget target)
+    {
+        if (index < 0 || index >= kNumLfos)
+            return;
+
+        auto& lfo   = lfos_[static_cast<size_t> (index)];
+        lfo.shape   = shape;
+        lfo.beats   = lfoRateBeats[std::clamp (rateIndex, 0, kNumLfoRates - 1)];
+        lfo.depth   = std::clamp (depth, -1.0f, 1.0f);
+        lfo.target  = target;
+    }
+
+    /**
+     *  Phase-lock to the host transport.  Call once per block with the
+     *  playhead's ppqPosition while the transport is running; when it is
+     *  stopped the LFOs free-run from wherever they are.
+     */
+    void syncToHost (double ppqPosition)
+    {
+        beatPos_ = ppqPosition;
+    }
+
+    /**
+     *  Evaluate every active LFO at the current position, add the outputs
+     *  to `out`, then advance by one control block of `numSamples`.
+     */
+    void process (int numSamples, double bpm, ModOffsets& out)
+    {
+        for (int i = 0; i < kNumLfos; ++i)
+        {
+            const auto& lfo = lfos_[static_cast<size_t> (i)];
+
+            if (lfo.target == ModTarget::off || std::abs (lfo.depth) < 0.001f)
+                continue;
+
+            out.add (lfo.target, lfo.depth * evaluate (lfo, i));
+        }
+
+        const double safeBpm = (bpm > 20.0) ? bpm : 120.0;
+        beatPos_ += numSamples * safeBpm / (60.0 * sampleRate);
+    }
+
+private:
+    struct Lfo
+    {
+        LfoShape  shape  = LfoShape::sine;
+        double    beats  = 4.0;
+        float     depth  = 0.0f;
+        ModTarget target = ModTarget::off;
+    };
+
+    /** Bipolar (-1..+1) output of one LFO at the current beat position. */
+    float evaluate (const Lfo& lfo, int lfoIndex) const
+    {
+        const double cycles = beatPos_ / lfo.beats;
+        const double cycleIndex = std::floor (cycles);
+        const float  phase = static_cast<float> (cycles - cycleIndex);   // 0..1
+
+        switch (lfo.shape)
+        {
+            case LfoShape::triangle:
+                return 1.0f - 4.0f * std::abs (phase - 0.5f);
+
+            case LfoShape::saw:
+                return 2.0f * phase - 1.0f;
+
+            case LfoShape::sampleHold:
+                return cycleRandom (static_cast<int64_t> (cycleIndex), lfoIndex);
+
+            case LfoShape::randomSmooth:
+            {
+                // Raised-cosine glide between this cycle's and the next cycle's value
+                const float a = cycleRandom (static_cast<int64_t> (cycleIndex), lfoIndex);
+                const float b = cycleRandom (static_cast<int64_t> (cycleIndex) + 1, lfoIndex);
+                const float w = 0.5f - 0.5f * lookupSine (0.5f * phase + 0.25f);   // 0.5 - 0.5cos(pi*phase)
+                return a + w * (b - a);
+            }
+
+            case LfoShape::sine:
+            case LfoShape::kCount:
+            default:
+                return lookupSine (phase);
+        }
+    }
+
+    /** Linear-interpolated wavetable sine, phase in cycles (wrapped). */
+    float lookupSine (float phase) const
+    {
+        return tables_->sine (phase);
+    }
+
+    /** Deterministic per-cycle random value in -1..+1 (integer hash, no state). */
+    static float cycleRandom (int64_t cycleIndex, int lfoIndex)
+    {
+        auto x = static_cast<uint32_t> (cycleIndex) * 0x9E3779B1u
+               ^ static_cast<uint32_t> (lfoIndex + 1) * 0x85EBCA77u;
+        x ^= x >> 16;  x *= 0x7FEB352Du;
+        x ^= x >> 15;  x *= 0x846CA68Bu;
+        x ^= x >> 16;
+        return static_cast<float> (x >> 8) * (2.0f / 16777216.0f) - 1.0f;
+    }
+
+    double sampleRate = 44100.0;
+    double beatPos_   = 0.0;
+
+    std::array<Lfo, kNumLfos> lfos_ {};
+    juce::SharedResourcePointer<DspTables> tables_;   // created with the processor (message thread)
+};
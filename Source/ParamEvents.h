@@ -0,0 +1,165 @@
+#pragma once
+
+/**
+ * ============================================================================
+ *  MacroMorphFX — Timestamped Performance Parameter Events
+ * ============================================================================
+ *
+ *  The performance params (scene selects, morph, morph X/Y, macros, morph
+ *  mode) are owned by the audio thread as a PerfState and only change
+ *  through timestamped events.  processBlock splits its control blocks at
+ *  each event's sample offset, so an event with a real position (MIDI)
+ *  takes effect on its exact sample regardless of the host buffer size.
+ *  Host automation is not sample-accurate (see below).
+ *
+ *  Producers:
+ *    - APVTS parameter listeners (host automation, GUI, preset loads).
+ *      JUCE's plugin wrappers hand over only the latest value per block,
+ *      without its position, so these are stamped at offset 0 of the next
+ *      block — the same timing as reading the APVTS at the top of the block.
+ *    - Any source that knows the exact position (e.g. incoming MIDI)
+ *      pushes its events with their real sample offset.
+ *
+ *  ParamEventQueue is a bounded lock-free multi-producer / single-consumer
+ *  ring (per-slot sequence numbers), because listeners can fire on the
+ *  message thread and on host threads at the same time.  The audio thread
+ *  is the only consumer.
+ *
+ *  Lane B — Params + smoothing + state
+ * ============================================================================
+ */
+
+#include "Params.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// ─── Performance parameter index ───────────────────────────────────────────
+namespace PerfParam
+{
+    enum Index
+    {
+        sceneA = 0,
+        sceneB,
+        sceneC,
+        sceneD,
+        morph,
+        morphX,
+        morphY,
+        macro1,
+        macro2,
+        macro3,
+        macro4,
+        morphMode,
+        ringScenes,
+        kCount   // = 13
+    };
+
+    /** APVTS ID of each performance param — order matches Index enum above. */
+    static constexpr std::array<std::string_view, kCount> ids = {{
+        Params::ID::sceneA,
+        Params::ID::sceneB,
+        Params::ID::sceneC,
+        Params::ID::sceneD,
+        Params::ID::morph,
+        Params::ID::morphX,
+        Params::ID::morphY,
+        Params::ID::macro1,
+        Params::ID::macro2,
+        Params::ID::macro3,
+        Params::ID::macro4,
+        Params::ID::morphMode,
+        Params::ID::ringScenes,
+    }};
+
+} // namespace PerfParam
+
+/** Audio-thread copy of the performance params (plain values, not 0..1). */
+struct PerfState
+{
+    float values[PerfParam::kCount] {};
+};
+
+/** One parameter change at a sample position inside the next block. */
+struct ParamEvent
+{
+    int   sampleOffset = 0;
+    int   param        = 0;     // PerfParam::Index
+    float value        = 0.0f;  // plain value
+};
+
+// ─── Lock-free MPSC event queue ────────────────────────────────────────────
+
+class ParamEventQueue
+{
+public:
+    static constexpr size_t kCapacity = 1024;   // power of two
+
+    ParamEventQueue()
+    {
+        for (size_t i = 0; i < kCapacity; ++i)
+            cells_[i].sequence.store (i, std::memory_order_relaxed);
+    }
+
+    /** Any thread.  Returns false (event dropped) if the queue is full. */
+    bool push (const ParamEvent& event)
+    {
+        size_t pos = enqueuePos_.load (std::memory_order_relaxed);
+        Cell* cell = nullptr;
+
+        for (;;)
+        {
+            cell = &cells_[pos & kMask];
+            const size_t seq  = cell->sequence.load (std::memory_order_acquire);
+            const auto   diff = static_cast<std::intptr_t> (seq) - static_cast<std::intptr_t> (pos);
+
+            if (diff == 0)
+            {
+                if (enqueuePos_.compare_exchange_weak (pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false;   // full
+            }
+            else
+            {
+                pos = enqueuePos_.load (std::memory_order_relaxed);
+            }
+        }
+
+        cell->event = event;
+        cell->sequence.store (pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Audio thread only.  Returns false if the queue is empty. */
+    bool pop (ParamEvent& event)
+    {
+        Cell& cell = cells_[dequeuePos_ & kMask];
+        const size_t seq = cell.sequence.load (std::memory_order_acquire);
+
+        if (static_cast<std::intptr_t> (seq) - static_cast<std::intptr_t> (dequeuePos_ + 1) < 0)
+            return false;   // empty (or a producer hasn't finished writing yet)
+
+        event = cell.event;
+        cell.sequence.store (dequeuePos_ + kCapacity, std::memory_order_release);
+        ++dequeuePos_;
+        return true;
+    }
+
+private:
+    static constexpr size_t kMask = kCapacity - 1;
+    static_assert ((kCapacity & kMask) == 0, "kCapacity must be a power of two");
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence { 0 };
+        ParamEvent event;
+    };
+
+    std::array<Cell, kCapacity> cells_;
+    alignas (64) std::atomic<size_t> enqueuePos_ { 0 };
+    alignas (64) size_t dequeuePos_ = 0;
+};
@@ -39,14 +39,39 @@ namespace Params
         static constexpr std::string_view macro3      = "macro3";
         static constexpr std::string_view macro4      = "macro4";
 
+        // Vector morph (see VectorMorph.h)
+        static constexpr std::string_view morphMode   = "morphMode";  // choice (A/B, XY, Ring)
+        static constexpr std::string_view morphX      = "morphX";     // 0..1
+        static constexpr std::string_view morphY      = "morphY";     // 0..1
+        static constexpr std::string_view sceneC      = "sceneC";     // 1..8 (discrete, XY corner)
+        static constexpr std::string_view sceneD      = "sceneD";     // 1..8 (discrete, XY corner)
+        static constexpr std::string_view ringScenes  = "morphRingScenes"; // choice (3..8)
+
+        // MIDI control (see MidiMapping.h)
+        static constexpr std::string_view midiChannel = "midiChannel"; // choice (Omni, 1..16)
+
+        // Engine
+        static constexpr std::string_view procQuantum = "procQuantum"; // choice (Host, 32, 64) — fixed internal block size
+        static constexpr std::string_view stereoMode  = "stereoMode";  // choice (StereoMode: L/R, M/S)
+        static constexpr std::string_view fxRouting   = "fxRouting";   // choice (Serial, Parallel) — delay / reverb topology
+        static constexpr std::string_view chainOrder  = "chainOrder";  // choice (24 module orders, ChainOrder.h)
+        static constexpr std::string_view offlineThreads = "offlineThreads"; // toggle — channel pairs on worker threads when rendering offline
+
         // Filter
         static constexpr std::string_view filtMode    = "filtMode";     // 0..2 (LP,BP,HP)
         static constexpr std::string_view filtCutoff  = "filtCutoffHz"; // Hz
         static constexpr std::string_view filtReso    = "filtReso";     // 0..1 (mapped to Q)
+        static constexpr std::string_view filtRoute   = "filtMsRoute";  // choice (MsRoute), M/S mode only
 
         // Drive
         static constexpr std::string_view driveAmt    = "driveAmt";     // 0..1
         static constexpr std::string_view driveTone   = "driveTone";    // 0..1
+        static constexpr std::string_view driveCurve  = "driveCurve";   // choice (DriveCurve)
+        static constexpr std::string_view crushBits   = "crushBits";    // 2..16 (16 = off)
+        static constexpr std::string_view crushRate   = "crushRate";    // 1..32 downsample factor (1 = off)
+        static constexpr std::string_view crushDither = "crushDither";  // bool
+        static constexpr std::string_view driveAutoGain = "driveAutoGain"; // choice (DriveAutoGain), global — not per scene
+        static constexpr std::string_view driveRoute  = "driveMsRoute"; // choice (MsRoute), M/S mode only
 
         // Delay
         static constexpr std::string_view delaySync   = "delaySync";    // discrete
@@ -54,12 +79,40 @@ namespace Params
         static constexpr std::string_view delayTone   = "delayTone";    // 0..1
         static constexpr std::string_view delayWidth  = "delayWidth";   // 0..1
         static constexpr std::string_view delayPingP  = "delayPingPong";// bool
+        static constexpr std::string_view delayMode   = "delayMode";    // choice (Sync, Free)
+        static constexpr std::string_view delayTime   = "delayTimeMs";  // 1..4000 (Free mode)
+        static constexpr std::string_view delayWow    = "delayWow";     // 0..1
+        static constexpr std::string_view delayFlutter= "delayFlutter"; // 0..1
+        static constexpr std::string_view delayDrift  = "delayDrift";   // 0..1
+        static constexpr std::string_view delaySat    = "delaySat";     // 0..1
+        static constexpr std::string_view delayDiffuse= "delayDiffuse"; // 0..1
+        static constexpr std::string_view delayLevel  = "delayLevel";   // 0..1 wet return (Parallel routing)
+        static constexpr std::string_view delayRoute  = "delayMsRoute"; // choice (MsRoute), M/S mode only
 
         // Reverb
         static constexpr std::string_view revSize     = "revSize";      // 0..1
         static constexpr std::string_view revDamp     = "revDamp";      // 0..1
         static constexpr std::string_view revPreDelay = "revPreDelayMs";// 0..200
         static constexpr std::string_view revWidth    = "revWidth";     // 0..1
+        static constexpr std::string_view revLevel    = "revLevel";     // 0..1 wet return (Parallel routing)
+        static constexpr std::string_view revRoute    = "revMsRoute";   // choice (MsRoute), M/S mode only
+        static constexpr std::string_view revFreeze   = "revFreeze";    // bool — infinite tail, input muted
+        static constexpr std::string_view revEarly    = "revEarly";     // 0..1 early-reflection level
+        static constexpr std::string_view revRoom     = "revRoom";      // choice (RoomShape: Room, Chamber, Hall, Church)
+        static constexpr std::string_view freezeLoop  = "revFreezeLoop";// bool (global) — play a captured loop while frozen
+
+        // Modulation — LFO 1..4 (per-LFO IDs, indexed 0..3)
+        static constexpr std::array<std::string_view, 4> lfoShape  = {{ "lfo1Shape",  "lfo2Shape",  "lfo3Shape",  "lfo4Shape"  }}; // choice (LfoShape)
+        static constexpr std::array<std::string_view, 4> lfoRate   = {{ "lfo1Rate",   "lfo2Rate",   "lfo3Rate",   "lfo4Rate"   }}; // choice (tempo sync)
+        static constexpr std::array<std::string_view, 4> lfoDepth  = {{ "lfo1Depth",  "lfo2Depth",  "lfo3Depth",  "lfo4Depth"  }}; // -1..+1
+        static constexpr std::array<std::string_view, 4> lfoTarget = {{ "lfo1Target", "lfo2Target", "lfo3Target", "lfo4Target" }}; // choice (ModTarget)
+
+        // Modulation — envelope followers (index 0 = main input, 1 = sidechain)
+        static constexpr std::array<std::string_view, 2> envAttack  = {{ "envInAttackMs",  "envScAttackMs"  }}; // ms
+        static constexpr std::array<std::string_view, 2> envRelease = {{ "envInReleaseMs", "envScReleaseMs" }}; // ms
+        static constexpr std::array<std::string_view, 2> envMode    = {{ "envInMode",      "envScMode"      }}; // choice (Peak, RMS)
+        static constexpr std::array<std::string_view, 2> envDepth   = {{ "envInDepth",     "envScDepth"     }}; // -1..+1
+        static constexpr std::array<std::string_view, 2> envTarget  = {{ "envInTarget",    "envScTarget"    }}; // choice (ModTarget)
     }
 
     // ---------------------------------------------------------------------
@@ -119,7 +172,7 @@ namespace Params
     };
 
     // Note: choice/toggle use min/max/default as 0/1 placeholders; real handling is in processor.
-    static constexpr std::array<ParamSpec, 25> all = {{
+    static constexpr std::array<ParamSpec, 85> all = {{
 
         // Global / performance
         { ID::bypass,      ParamType::toggle,    0.f,   1.f,   0.f,   2, 0, SmoothGroup::none },
@@ -157,5 +210,99 @@ namespace Params
         { ID::revDamp,     ParamType::float01,   0.f,   1.f,   0.5f,  0, 0, SmoothGroup::tone },
         { ID::revPreDelay, ParamType::floatRange,0.f,   200.f,  10.f, 0, 0, SmoothGroup::timeish },
         { ID::revWidth,    ParamType::float01,   0.f,   1.f,   0.8f,  0, 0, SmoothGroup::tone },
+
+        // Modulation — LFOs (default: off, 1 bar sine)
+        { ID::lfoShape[0], ParamType::choice,    0.f,   1.f,   0.f,   5, 0, SmoothGroup::none },
+        { ID::lfoRate[0],  ParamType::choice,    0.f,   1.f,   0.f,   8, 4, SmoothGroup::none },
+        { ID::lfoDepth[0], ParamType::floatRange,-1.f,  1.f,   0.f,   0, 0, SmoothGroup::none },
+        { ID::lfoTarget[0],ParamType::choice,    0.f,   1.f,   0.f,   8, 0, SmoothGroup::none },
+        { ID::lfoShape[1], ParamType::choice,    0.f,   1.f,   0.f,   5, 0, SmoothGroup::none },
+        { ID::lfoRate[1],  ParamType::choice,    0.f,   1.f,   0.f,   8, 4, SmoothGroup::none },
+        { ID::lfoDepth[1], ParamType::floatRange,-1.f,  1.f,   0.f,   0, 0, SmoothGroup::none },
+        { ID::lfoTarget[1],ParamType::choice,    0.f,   1.f,   0.f,   8, 0, SmoothGroup::none },
+        { ID::lfoShape[2], ParamType::choice,    0.f,   1.f,   0.f,   5, 0, SmoothGroup::none },
+        { ID::lfoRate[2],  ParamType::choice,    0.f,   1.f,   0.f,   8, 4, SmoothGroup::none },
+        { ID::lfoDepth[2], ParamType::floatRange,-1.f,  1.f,   0.f,   0, 0, SmoothGroup::none },
+        { ID::lfoTarget[2],ParamType::choice,    0.f,   1.f,   0.f,   8, 0, SmoothGroup::none },
+        { ID::lfoShape[3], ParamType::choice,    0.f,   1.f,   0.f,   5, 0, SmoothGroup::none },
+        { ID::lfoRate[3],  ParamType::choice,    0.f,   1.f,   0.f,   8, 4, SmoothGroup::none },
+        { ID::lfoDepth[3], ParamType::floatRange,-1.f,  1.f,   0.f,   0, 0, SmoothGroup::none },
+        { ID::lfoTarget[3],ParamType::choice,    0.f,   1.f,   0.f,   8, 0, SmoothGroup::none },
+
+        // Modulation — envelope followers (default: off)
+        { ID::envAttack[0], ParamType::floatRange,0.1f, 100.f,  5.f,  0, 0, SmoothGroup::none },
+        { ID::envRelease[0],ParamType::floatRange,5.f,  2000.f, 150.f,0, 0, SmoothGroup::none },
+        { ID::envMode[0],   ParamType::choice,    0.f,  1.f,    0.f,  2, 0, SmoothGroup::none },
+        { ID::envDepth[0],  ParamType::floatRange,-1.f, 1.f,    0.f,  0, 0, SmoothGroup::none },
+        { ID::envTarget[0], ParamType::choice,    0.f,  1.f,    0.f,  8, 0, SmoothGroup::none },
+        { ID::envAttack[1], ParamType::floatRange,0.1f, 100.f,  5.f,  0, 0, SmoothGroup::none },
+        { ID::envRelease[1],ParamType::floatRange,5.f,  2000.f, 150.f,0, 0, SmoothGroup::none },
+        { ID::envMode[1],   ParamType::choice,    0.f,  1.f,    0.f,  2, 0, SmoothGroup::none },
+        { ID::envDepth[1],  ParamType::floatRange,-1.f, 1.f,    0.f,  0, 0, SmoothGroup::none },
+        { ID::envTarget[1], ParamType::choice,    0.f,  1.f,    0.f,  8, 0, SmoothGroup::none },
+
+        // Vector morph (default: A/B, pad centre, corners = scenes 1..4, ring of 8)
+        { ID::morphMode,   ParamType::choice,    0.f,   1.f,   0.f,   3, 0, SmoothGroup::none },
+        { ID::morphX,      ParamType::float01,   0.f,   1.f,   0.5f,  0, 0, SmoothGroup::gain },
+        { ID::morphY,      ParamType::float01,   0.f,   1.f,   0.5f,  0, 0, SmoothGroup::gain },
+        { ID::sceneC,      ParamType::choice,    0.f,   1.f,   0.f,   8, 2, SmoothGroup::none }, // default scene 3
+        { ID::sceneD,      ParamType::choice,    0.f,   1.f,   0.f,   8, 3, SmoothGroup::none }, // default scene 4
+        { ID::ringScenes,  ParamType::choice,    0.f,   1.f,   0.f,   6, 5, SmoothGroup::none }, // default 8 scenes
+
+        // MIDI control (default: omni)
+        { ID::midiChannel, ParamType::choice,    0.f,   1.f,   0.f,  17, 0, SmoothGroup::none },
+
+        // Delay — free time (default: tempo sync, 375 ms = 1/8 at 80 BPM)
+        { ID::delayMode,   ParamType::choice,    0.f,   1.f,   0.f,   2, 0, SmoothGroup::none },
+        { ID::delayTime,   ParamType::floatRange,1.f,   4000.f,375.f, 0, 0, SmoothGroup::timeish },
+
+        // Delay — tape section (default: off)
+        { ID::delayWow,    ParamType::float01,   0.f,   1.f,   0.f,   0, 0, SmoothGroup::tone },
+        { ID::delayFlutter,ParamType::float01,   0.f,   1.f,   0.f,   0, 0, SmoothGroup::tone },
+        { ID::delayDrift,  ParamType::float01,   0.f,   1.f,   0.f,   0, 0, SmoothGroup::tone },
+        { ID::delaySat,    ParamType::float01,   0.f,   1.f,   0.f,   0, 0, SmoothGroup::tone },
+        { ID::delayDiffuse,ParamType::float01,   0.f,   1.f,   0.f,   0, 0, SmoothGroup::tone },
+
+        // Drive — waveshaper curve (default: Tanh)
+        { ID::driveCurve,  ParamType::choice,    0.f,   1.f,   0.f,   6, 0, SmoothGroup::none },
+
+        // Drive — Lo-Fi stage (default: off)
+        { ID::crushBits,   ParamType::floatRange,2.f,   16.f,  16.f,  0, 0, SmoothGroup::tone },
+        { ID::crushRate,   ParamType::floatRange,1.f,   32.f,  1.f,   0, 0, SmoothGroup::tone },
+        { ID::crushDither, ParamType::toggle,    0.f,   1.f,   0.f,   2, 0, SmoothGroup::none },
+
+        // Drive — auto-gain (global, default: off)
+        { ID::driveAutoGain, ParamType::choice,  0.f,   1.f,   0.f,   3, 0, SmoothGroup::none },
+
+        // Engine — processing quantum (default: follow the host block size)
+        { ID::procQuantum, ParamType::choice,    0.f,   1.f,   0.f,   3, 0, SmoothGroup::none },
+
+        // Engine — stereo mode (default: L/R)
+        { ID::stereoMode,  ParamType::choice,    0.f,   1.f,   0.f,   2, 0, SmoothGroup::none },
+
+        // M/S routing per module (default: both channels)
+        { ID::filtRoute,   ParamType::choice,    0.f,   1.f,   0.f,   3, 0, SmoothGroup::none },
+        { ID::driveRoute,  ParamType::choice,    0.f,   1.f,   0.f,   3, 0, SmoothGroup::none },
+        { ID::delayRoute,  ParamType::choice,    0.f,   1.f,   0.f,   3, 0, SmoothGroup::none },
+        { ID::revRoute,    ParamType::choice,    0.f,   1.f,   0.f,   3, 0, SmoothGroup::none },
+
+        // Delay / reverb routing (default: serial, full wet returns)
+        { ID::fxRouting,   ParamType::choice,    0.f,   1.f,   0.f,   2, 0, SmoothGroup::none },
+        { ID::delayLevel,  ParamType::float01,   0.f,   1.f,   1.f,   0, 0, SmoothGroup::gain },
+        { ID::revLevel,    ParamType::float01,   0.f,   1.f,   1.f,   0, 0, SmoothGroup::gain },
+
+        // Module order (default: Filter → Drive → Delay → Reverb)
+        { ID::chainOrder,  ParamType::choice,    0.f,   1.f,   0.f,  24, 0, SmoothGroup::none },
+
+        // Multichannel: spread channel pairs over worker threads offline (default on)
+        { ID::offlineThreads, ParamType::toggle, 0.f,   1.f,   1.f,   2, 0, SmoothGroup::none },
+
+        // Reverb — freeze (default: off; loop playback off)
+        { ID::revFreeze,   ParamType::toggle,    0.f,   1.f,   0.f,   2, 0, SmoothGroup::none },
+        { ID::freezeLoop,  ParamType::toggle,    0.f,   1.f,   0.f,   2, 0, SmoothGroup::none },
+
+        // Reverb — early reflections (default: off, Room)
+        { ID::revEarly,    ParamType::float01,   0.f,   1.f,   0.f,   0, 0, SmoothGroup::gain },
+        { ID::revRoom,     ParamType::choice,    0.f,   1.f,   0.f,   4, 0, SmoothGroup::none },
     }};
 } // namespace Params
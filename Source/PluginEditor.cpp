@@ -34,10 +34,13 @@ static void setupLabel (juce::Label& l, float fontSize,
 
 // Display names for scene parameters (indexed by SceneParam::Index)
 static const char* const kParamDisplayNames[SceneParam::kCount] = {
-    "Mode", "Cutoff", "Reso",               // Filter (3)
-    "Amount", "Tone",                        // Drive (2)
-    "Sync", "FB", "Tone", "Width", "PP",     // Delay (5)
-    "Size", "Damp", "PDly", "Width"          // Reverb (4)
+    "Mode", "Cutoff", "Reso", "M/S",        // Filter (4)
+    "Amount", "Tone", "Curve",               // Drive (7)
+    "Bits", "Rate", "Dith", "M/S",
+    "Sync", "FB", "Tone", "Width", "PP",     // Delay (14)
+    "Mode", "Time", "Wow", "Flut", "Drift", "Sat", "Diff", "Level", "M/S",
+    "Size", "Damp", "PDly", "Width",         // Reverb (9)
+    "Level", "Frz", "Early", "Room", "M/S"
 };
 
 static juce::String formatSceneValue (int paramIndex, float value)
@@ -55,15 +58,39 @@ static juce::String formatSceneValue (int paramIndex, float value)
                 return juce::String (value / 1000.0f, 1) + " kHz";
             return juce::String (static_cast<int> (value)) + " Hz";
         }
+        case SceneParam::driveCurve:
+            return driveCurveNames[std::clamp (static_cast<int> (value), 0, static_cast<int> (DriveCurve::kCount) - 1)];
+        case SceneParam::crushBits:
+            return juce::String (value, 1) + " bit";
+        case SceneParam::crushRate:
+            return value < 1.05f ? juce::String ("Off") : "1/" + juce::String (value, 1);
+        case SceneParam::crushDither:
+            return value > 0.5f ? "On" : "Off";
         case SceneParam::delaySync:
         {
             static const char* names[] = { "1/32", "1/16", "1/8", "1/4", "1/2", "1 Bar", "1/8D", "1/4D" };
             return names[std::clamp (static_cast<int> (value), 0, 7)];
         }
         case SceneParam::delayPingP:
+        case SceneParam::revFreeze:
             return value > 0.5f ? "On" : "Off";
+        case SceneParam::delayMode:
+            return value > 0.5f ? "Free" : "Sync";
+        case SceneParam::delayTime:
+        {
+            if (value >= 1000.0f)
+                return juce::String (value / 1000.0f, 2) + " s";
+            return juce::String (static_cast<int> (value)) + " ms";
+        }
         case SceneParam::revPreDelay:
             return juce::String (value, 1) + " ms";
+        case SceneParam::revRoom:
+            return roomShapeNames[std::clamp (static_cast<int> (value), 0, static_cast<int> (RoomShape::kCount) - 1)];
+        case SceneParam::filtRoute:
+        case SceneParam::driveRoute:
+        case SceneParam::delayRoute:
+        case SceneParam::revRoute:
+            return msRouteNames[std::clamp (static_cast<int> (value), 0, static_cast<int> (MsRoute::kCount) - 1)];
         default:
             return juce::String (value, 2);
     }
@@ -83,17 +110,28 @@ static const MacroTargetOption kMacroTargetOptions[] = {
     { SceneParam::filtReso,    "Reso"       },
     { SceneParam::driveAmt,    "Drive Amt"  },
     { SceneParam::driveTone,   "Drive Tone" },
+    { SceneParam::crushBits,   "Crush Bits" },
+    { SceneParam::crushRate,   "Crush Rate" },
     { SceneParam::delayFb,     "Delay FB"   },
     { SceneParam::delayTone,   "Delay Tone" },
     { SceneParam::delayWidth,  "Delay Width"},
+    { SceneParam::delayTime,   "Delay Time" },
+    { SceneParam::delayWow,    "Delay Wow"  },
+    { SceneParam::delayFlutter,"Delay Flut" },
+    { SceneParam::delayDrift,  "Delay Drift"},
+    { SceneParam::delaySat,    "Delay Sat"  },
+    { SceneParam::delayDiffuse,"Delay Diff" },
+    { SceneParam::delayLevel,  "Delay Level"},
     { SceneParam::revSize,     "Rev Size"   },
     { SceneParam::revDamp,     "Rev Damp"   },
     { SceneParam::revPreDelay, "Rev PDly"   },
     { SceneParam::revWidth,    "Rev Width"  },
+    { SceneParam::revLevel,    "Rev Level"  },
+    { SceneParam::revEarly,    "Rev Early"  },
 };
-static constexpr int kNumMacroTargetOptions = 11;
+static constexpr int kNumMacroTargetOptions = 22;
 
-// Convert a SceneParam index to a ComboBox item ID (2..12), or 1 for "None"
+// Convert a SceneParam index to a ComboBox item ID (2..23), or 1 for "None"
 static int sceneParamToComboId (int sceneParamIndex)
 {
     for (int i = 0; i < kNumMacroTargetOptions; ++i)
@@ -334,6 +372,10 @@ MacroMorphFXEditor::MacroMorphFXEditor (MacroMorphFXProcessor& p)
 
         if (i == SceneParam::filtCutoff)
             slider.setSkewFactorFromMidPoint (1000.0);
+        else if (i == SceneParam::delayTime)
+            slider.setSkewFactorFromMidPoint (500.0);
+        else if (i == SceneParam::crushRate)
+            slider.setSkewFactorFromMidPoint (4.0);
 
         slider.setColour (juce::Slider::trackColourId,             colAccentDim);
         slider.setColour (juce::Slider::thumbColourId,             colAccent);
@@ -559,19 +601,30 @@ void MacroMorphFXEditor::resized()
         // Edit target button (top-right of module panel area)
         editTargetBtn_.setBounds (w - mx - 75, panelY, 75, 18);
 
-        static const int filterParams[] = { SceneParam::filtMode, SceneParam::filtCutoff, SceneParam::filtReso };
-        static const int driveParams[]  = { SceneParam::driveAmt, SceneParam::driveTone };
-        static const int delayParams[]  = { SceneParam::delaySync, SceneParam::delayFb, SceneParam::delayTone,
-                                            SceneParam::delayWidth, SceneParam::delayPingP };
+        static const int filterParams[] = { SceneParam::filtMode, SceneParam::filtCutoff, SceneParam::filtReso,
+                                            SceneParam::filtRoute };
+        static const int driveParams[]  = { SceneParam::driveCurve, SceneParam::driveAmt, SceneParam::driveTone,
+                                            SceneParam::crushBits, SceneParam::crushRate, SceneParam::crushDither,
+                                            SceneParam::driveRoute };
+        static const int delayParams[]  = { SceneParam::delayMode, SceneParam::delaySync, SceneParam::delayTime,
+                                            SceneParam::delayFb, SceneParam::delayTone,
+                                            SceneParam::delayWidth, SceneParam::delayPingP,
+                                            SceneParam::delayWow, SceneParam::delayFlutter,
+                                            SceneParam::delayDrift, SceneParam::delaySat,
+                                            SceneParam::delayDiffuse, SceneParam::delayLevel,
+                                            SceneParam::delayRoute };
         static const int reverbParams[] = { SceneParam::revSize, SceneParam::revDamp,
-                                            SceneParam::revPreDelay, SceneParam::revWidth };
+                                            SceneParam::revPreDelay, SceneParam::revWidth,
+                                            SceneParam::revLevel, SceneParam::revFreeze,
+                                            SceneParam::revEarly, SceneParam::revRoom,
+                                            SceneParam::revRoute };
 
         struct ColInfo { const int* params; int count; };
         ColInfo cols[4] = {
-            { filterParams, 3 },
-            { driveParams,  2 },
-            { delayParams,  5 },
-            { reverbParams, 4 }
+            { filterParams, 4 },
+            { driveParams,  7 },
+            { delayParams,  14 },
+            { reverbParams, 9 }
         };
 
         for (int col = 0; col < 4; ++col)
@@ -129,7 +129,7 @@ private:
 
     // ── Layout constants ───────────────────────────────────────────────
     static constexpr int kCollapsedHeight    = 500;
-    static constexpr int kModulePanelHeight  = 140;
+    static constexpr int kModulePanelHeight  = 338;
     static constexpr int kMacroConfigHeight  = 165;
 
     // ── Colours ────────────────────────────────────────────────────────
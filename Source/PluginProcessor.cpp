@@ -12,21 +12,49 @@ static double getSceneParamSmoothTimeSec (int paramIndex)
         case SceneParam::filtMode:    return 0.0;    // discrete — instant
         case SceneParam::filtCutoff:  return 0.020;  // cutoff ~20 ms
         case SceneParam::filtReso:    return 0.030;  // tone ~30 ms
+        case SceneParam::filtRoute:   return 0.0;    // discrete — MsRouter ramps it
         case SceneParam::driveAmt:    return 0.030;
         case SceneParam::driveTone:   return 0.030;
+        case SceneParam::driveCurve:  return 0.0;    // discrete
+        case SceneParam::crushBits:   return 0.030;
+        case SceneParam::crushRate:   return 0.030;
+        case SceneParam::crushDither: return 0.0;    // discrete
+        case SceneParam::driveRoute:  return 0.0;    // discrete
         case SceneParam::delaySync:   return 0.0;    // discrete
         case SceneParam::delayFb:     return 0.050;  // feedback ~50 ms
         case SceneParam::delayTone:   return 0.030;
         case SceneParam::delayWidth:  return 0.030;
         case SceneParam::delayPingP:  return 0.0;    // discrete
+        case SceneParam::delayMode:   return 0.0;    // discrete
+        case SceneParam::delayTime:   return 0.100;  // timeish — glides via the interpolated read
+        case SceneParam::delayWow:    return 0.030;
+        case SceneParam::delayFlutter:return 0.030;
+        case SceneParam::delayDrift:  return 0.030;
+        case SceneParam::delaySat:    return 0.030;
+        case SceneParam::delayDiffuse:return 0.030;
+        case SceneParam::delayLevel:  return 0.020;  // gain ~20 ms
+        case SceneParam::delayRoute:  return 0.0;    // discrete
         case SceneParam::revSize:     return 0.100;  // timeish ~100 ms
         case SceneParam::revDamp:     return 0.030;
         case SceneParam::revPreDelay: return 0.100;
         case SceneParam::revWidth:    return 0.030;
+        case SceneParam::revLevel:    return 0.020;
+        case SceneParam::revFreeze:   return 0.0;    // discrete — loop crossfades its own way in / out
+        case SceneParam::revEarly:    return 0.020;  // gain
+        case SceneParam::revRoom:     return 0.0;    // discrete
+        case SceneParam::revRoute:    return 0.0;    // discrete
         default:                      return 0.0;
     }
 }
 
+//==============================================================================
+// Helper: true if `paramId` is one of a group of per-slot IDs (e.g. lfo1..4Shape).
+template <size_t N>
+static bool isAnyOf (std::string_view paramId, const std::array<std::string_view, N>& ids)
+{
+    return std::find (ids.begin(), ids.end(), paramId) != ids.end();
+}
+
 //==============================================================================
 // Helper: return choice labels for choice-type parameters.
 static juce::StringArray getChoiceLabels (std::string_view paramId)
@@ -36,12 +64,65 @@ static juce::StringArray getChoiceLabels (std::string_view paramId)
     if (paramId == filtMode)
         return { "LP", "BP", "HP" };
 
-    if (paramId == sceneA || paramId == sceneB)
+    if (paramId == sceneA || paramId == sceneB || paramId == sceneC || paramId == sceneD)
         return { "1", "2", "3", "4", "5", "6", "7", "8" };
 
+    if (paramId == morphMode)
+        return juce::StringArray (morphModeNames, static_cast<int> (MorphMode::kCount));
+
+    if (paramId == ringScenes)
+        return { "3", "4", "5", "6", "7", "8" };
+
+    if (paramId == driveCurve)
+        return juce::StringArray (driveCurveNames, static_cast<int> (DriveCurve::kCount));
+
+    if (paramId == driveAutoGain)
+        return juce::StringArray (driveAutoGainNames, static_cast<int> (DriveAutoGain::kCount));
+
     if (paramId == delaySync)
         return { "1/32", "1/16", "1/8", "1/4", "1/2", "1 Bar", "1/8 Dot", "1/4 Dot" };
 
+    if (paramId == delayMode)
+        return { "Sync", "Free" };
+
+    if (isAnyOf (paramId, lfoShape))
+        return juce::StringArray (lfoShapeNames, static_cast<int> (LfoShape::kCount));
+
+    if (isAnyOf (paramId, lfoRate))
+        return juce::StringArray (lfoRateNames, kNumLfoRates);
+
+    if (isAnyOf (paramId, lfoTarget) || isAnyOf (paramId, envTarget))
+        return juce::StringArray (modTargetNames, static_cast<int> (ModTarget::kCount));
+
+    if (isAnyOf (paramId, envMode))
+        return { "Peak", "RMS" };
+
+    if (paramId == procQuantum)
+        return { "Host", "32", "64" };
+
+    if (paramId == chainOrder)
+        return getChainOrderLabels();
+
+    if (paramId == fxRouting)
+        return { "Serial", "Parallel" };
+
+    if (paramId == stereoMode)
+        return juce::StringArray (stereoModeNames, static_cast<int> (StereoMode::kCount));
+
+    if (paramId == revRoom)
+        return juce::StringArray (roomShapeNames, static_cast<int> (RoomShape::kCount));
+
+    if (paramId == filtRoute || paramId == driveRoute || paramId == delayRoute || paramId == revRoute)
+        return juce::StringArray (msRouteNames, static_cast<int> (MsRoute::kCount));
+
+    if (paramId == midiChannel)
+    {
+        juce::StringArray channels { "Omni" };
+        for (int ch = 1; ch <= 16; ++ch)
+            channels.add (juce::String (ch));
+        return channels;
+    }
+
     return { "Off", "On" };
 }
 
@@ -81,6 +162,10 @@ MacroMorphFXProcessor::createParameterLayout()
 
                 if (spec.id == Params::ID::filtCutoff)
                     range.setSkewForCentre (1000.0f);
+                else if (spec.id == Params::ID::crushRate)
+                    range.setSkewForCentre (4.0f);
+                else if (spec.id == Params::ID::delayTime)
+                    range.setSkewForCentre (500.0f);
 
                 layout.add (std::make_unique<juce::AudioParameterFloat> (
                     juce::ParameterID { id, 1 },
@@ -116,17 +201,33 @@ MacroMorphFXProcessor::createParameterLayout()
 }
 
 //==============================================================================
+// The hot / cold / telemetry regions rely on cache-line alignment of the object
+static_assert (alignof (MacroMorphFXProcessor) >= 64);
+
 MacroMorphFXProcessor::MacroMorphFXProcessor()
      : AudioProcessor (BusesProperties()
-                       .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
-                       .withOutput ("Output", juce::AudioChannelSet::stereo(), true)),
+                       .withInput  ("Input",     juce::AudioChannelSet::stereo(), true)
+                       .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false)
+                       .withOutput ("Output",    juce::AudioChannelSet::stereo(), true)),
        apvts (*this, nullptr, juce::Identifier ("MacroMorphFXState"), createParameterLayout())
 {
     loadFactoryPresetData (0);
+
+    for (const auto& id : PerfParam::ids)
+        apvts.addParameterListener (juce::String (id.data(), id.size()), this);
+
+    // Latency reports and MIDI → APVTS reflection are polled: posting a
+    // message from the audio thread (triggerAsyncUpdate) can lock or allocate
+    startTimerHz (kMessagePollHz);
 }
 
 MacroMorphFXProcessor::~MacroMorphFXProcessor()
 {
+    stopTimer();
+    pairPool_.reset();
+
+    for (const auto& id : PerfParam::ids)
+        apvts.removeParameterListener (juce::String (id.data(), id.size()), this);
 }
 
 //==============================================================================
@@ -135,7 +236,7 @@ const juce::String MacroMorphFXProcessor::getName() const
     return JucePlugin_Name;
 }
 
-bool MacroMorphFXProcessor::acceptsMidi() const    { return false; }
+bool MacroMorphFXProcessor::acceptsMidi() const    { return true; }
 bool MacroMorphFXProcessor::producesMidi() const   { return false; }
 bool MacroMorphFXProcessor::isMidiEffect() const   { return false; }
 double MacroMorphFXProcessor::getTailLengthSeconds() const { return 0.0; }
@@ -167,79 +268,428 @@ void MacroMorphFXProcessor::prepareToPlay (double sampleRate, int samplesPerBloc
     juce::dsp::ProcessSpec spec;
     spec.sampleRate       = sampleRate;
     spec.maximumBlockSize = static_cast<juce::uint32> (samplesPerBlock);
-    spec.numChannels      = static_cast<juce::uint32> (getTotalNumOutputChannels());
+    spec.numChannels      = static_cast<juce::uint32> (getMainBusNumOutputChannels());
+
+    // Channel pairs by speaker type: each pair's modules see at most two
+    // channels, and modules and M/S routers only ever see one control block
+    const auto channelPairs = pairChannels (getChannelLayoutOfBus (false, 0), static_cast<int> (spec.numChannels));
+    const auto numPairs     = static_cast<int> (channelPairs.size());
+
+    const bool samePairs = pairs_.size() == channelPairs.size()
+                        && std::equal (channelPairs.begin(), channelPairs.end(), pairs_.begin(),
+                                       [] (const ChannelPair& c, const auto& pair) { return c == pair->channels; });
+
+    // The reverb's frozen-loop buffers are only laid out while
+    // revFreezeLoop is on (kept once reserved, until the next full layout)
+    const bool freezeLoop = getRawParam (apvts, Params::ID::freezeLoop) > 0.5f;
+
+    const bool sameLayout = isPrepared_ && samePairs
+                         && spec.numChannels      == preparedSpec_.numChannels
+                         && spec.maximumBlockSize == preparedSpec_.maximumBlockSize
+                         && sampleRate <= arenaRate_
+                         && (loopReserved_ || ! freezeLoop);
+
+    // Identical spec (some hosts re-prepare on every transport start or
+    // latency change): keep the tails, smoothers and FIFO exactly as they are
+    if (sameLayout && sampleRate == preparedSpec_.sampleRate)
+        return;
+
+    inputGain.reset (sampleRate, 0.02);
+    outputGain.reset (sampleRate, 0.02);
+
+    // Prepared for kControlBlockSize, not the host block: in quantum mode a
+    // host block smaller than the quantum still reaches them as control blocks
+    auto pairSpec = [&spec, &channelPairs] (int pair)
+    {
+        auto result = spec;
+        result.numChannels      = channelPairs[static_cast<size_t> (pair)].isStereo() ? 2u : 1u;
+        result.maximumBlockSize = static_cast<juce::uint32> (kControlBlockSize);
+        return result;
+    };
+
+    if (sameLayout)
+    {
+        // New sample rate only: the arena was laid out for arenaRate_, so
+        // every buffer stays where it is.  Delay lines are resampled,
+        // smoothers keep their current values.
+        for (int p = 0; p < numPairs; ++p)
+            pairs_[static_cast<size_t> (p)]->changeSampleRate (pairSpec (p));
 
-    inputGain.prepare (spec);
-    inputGain.setRampDurationSeconds (0.02);
+        for (int i = 0; i < SceneParam::kCount; ++i)
+            smoothScene_[static_cast<size_t> (i)].reset (sampleRate, getSceneParamSmoothTimeSec (i));
 
+        bypassSmooth_.reset (sampleRate, 0.01);
+    }
+    else
+    {
+        // One module chain per pair of this layout
+        pairs_.resize (static_cast<size_t> (numPairs));
+
+        for (int p = 0; p < numPairs; ++p)
+        {
+            auto& pair = pairs_[static_cast<size_t> (p)];
+
+            if (pair == nullptr)
+                pair = std::make_unique<PairChain>();
+
+            pair->channels = channelPairs[static_cast<size_t> (p)];
+        }
+
+        for (int p = 0; p < numPairs; ++p)
+            pairs_[static_cast<size_t> (p)]->prepare (pairSpec (p));
+
+        // Control blocks per chunk: one per kControlBlockSize samples, plus
+        // one split per event
+        const int chunkSize = std::max (samplesPerBlock, kMaxQuantum);
+        controlBlocks_.resize (static_cast<size_t> (chunkSize / kControlBlockSize + 1 + kMaxEventsPerBlock));
+
+        // Offline worker pool for pairs 1.. (threads idle unless rendering
+        // offline): no more threads than cores, one job per pair
+        if (numPairs > 1)
+        {
+            const int numThreads = std::min (numPairs - 1, juce::SystemStats::getNumCpus());
+
+            if (pairPool_ == nullptr || pairPool_->getNumThreads() < numThreads)
+            {
+                pairPool_.reset();
+                pairPool_ = std::make_unique<juce::ThreadPool> (numThreads);
+            }
+
+            pairJobs_.resize (static_cast<size_t> (numPairs));
+
+            for (int p = 1; p < numPairs; ++p)
+                if (pairJobs_[static_cast<size_t> (p)] == nullptr)
+                    pairJobs_[static_cast<size_t> (p)] = std::make_unique<PairJob> (*this, p);
+        }
+
+        inputGain.setCurrentAndTargetValue (juce::Decibels::decibelsToGain (getRawParam (apvts, Params::ID::inputGainDb)));
+        outputGain.setCurrentAndTargetValue (juce::Decibels::decibelsToGain (getRawParam (apvts, Params::ID::outputGainDb)));
+
+        // All audio memory from one arena: a layout pass sizes it, the second
+        // pass hands out (zeroed) pointers.  Reused when the size hasn't grown.
+        // Rate-dependent buffers are sized for AudioArena::kMaxSampleRate.
+        loopReserved_ = freezeLoop;
+
+        arena_.beginLayout();
+        assignBuffers (arena_, spec);
+        arena_.commit();
+        assignBuffers (arena_, spec);
+        arenaRate_ = AudioArena::capacityRate (sampleRate);
+
+        quantumMidi_.ensureSize (2048);
+
+        quantum_ = quantumForChoice (static_cast<int> (getRawParam (apvts, Params::ID::procQuantum)));
+        quantumLatency_ = quantum_;
+        setLatencySamples (quantum_);
+        resetQuantumFifo();
+
+        // Initialise parameter smoothers with per-SPEC smoothing times
+        for (int i = 0; i < SceneParam::kCount; ++i)
+        {
+            smoothScene_[static_cast<size_t> (i)].reset (sampleRate,
+                                                          getSceneParamSmoothTimeSec (i));
+            smoothScene_[static_cast<size_t> (i)].setCurrentAndTargetValue (
+                SceneParam::info[static_cast<size_t> (i)].defaultVal);
+        }
+
+        // Bypass crossfade: 10 ms per SPEC
+        bypassSmooth_.reset (sampleRate, 0.01);
+        bypassSmooth_.setCurrentAndTargetValue (0.0f);
+    }
+
+    preparedSpec_ = spec;
+    isPrepared_   = true;
+
+    hostTransport_.prepare (sampleRate);
+    lfoBank_.prepare (sampleRate);
+    envFollower_.prepare (spec);
+
+    // Start from the current APVTS values; anything already queued is stale
+    ParamEvent stale;
+    while (paramEvents_.pop (stale)) {}
+    readPerfState (perfState_);
+    perfResync_ = false;
+}
+
+void MacroMorphFXProcessor::assignBuffers (AudioArena& arena, const juce::dsp::ProcessSpec& spec)
+{
+    const int numChannels = static_cast<int> (spec.numChannels);
+
+    // Processing order: quantum FIFO → dry copy → send → per pair:
+    // filter → drive → delay → reverb
+    for (auto& fifo : quantumFifo_)
+        arena.assign (fifo, numChannels, kMaxQuantum);
+
+    const int chunkSize = std::max (static_cast<int> (spec.maximumBlockSize), kMaxQuantum);
+
+    arena.assign (quantumSidechain_, 2, kMaxQuantum);
+    arena.assign (dryBuffer, numChannels, chunkSize);
+    arena.assign (reverbSend, numChannels, chunkSize);
+
+    for (auto& pair : pairs_)
+        pair->assignBuffers (arena, loopReserved_);
+}
+
+std::vector<MacroMorphFXProcessor::ChannelPair>
+MacroMorphFXProcessor::pairChannels (const juce::AudioChannelSet& layout, int numChannels)
+{
+    using Set = juce::AudioChannelSet;
+
+    // Left / right speaker types that make a stereo pair
+    static constexpr std::pair<Set::ChannelType, Set::ChannelType> kSpeakerPairs[] = {
+        { Set::left,             Set::right },
+        { Set::leftSurround,     Set::rightSurround },
+        { Set::leftCentre,       Set::rightCentre },
+        { Set::leftSurroundSide, Set::rightSurroundSide },
+        { Set::leftSurroundRear, Set::rightSurroundRear },
+        { Set::wideLeft,         Set::wideRight },
+        { Set::topFrontLeft,     Set::topFrontRight },
+        { Set::topSideLeft,      Set::topSideRight },
+        { Set::topRearLeft,      Set::topRearRight },
+        { Set::bottomFrontLeft,  Set::bottomFrontRight },
+        { Set::bottomSideLeft,   Set::bottomSideRight },
+        { Set::bottomRearLeft,   Set::bottomRearRight },
+        { Set::proximityLeft,    Set::proximityRight }
+    };
+
+    std::vector<ChannelPair> pairs;
+    std::vector<bool> paired (static_cast<size_t> (std::max (numChannels, 1)), false);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        if (paired[static_cast<size_t> (ch)])
+            continue;
+
+        ChannelPair pair { ch, -1 };
+
+        // Channels past the layout (host / layout mismatch) run alone
+        const auto type = ch < layout.size() ? layout.getTypeOfChannel (ch) : Set::unknown;
+
+        for (const auto& [leftType, rightType] : kSpeakerPairs)
+        {
+            if (type != leftType && type != rightType)
+                continue;
+
+            const bool isLeft  = type == leftType;
+            const int  partner = layout.getChannelIndexForType (isLeft ? rightType : leftType);
+
+            if (partner > ch && partner < numChannels)
+            {
+                pair = isLeft ? ChannelPair { ch, partner } : ChannelPair { partner, ch };
+                paired[static_cast<size_t> (partner)] = true;
+            }
+
+            break;
+        }
+
+        pairs.push_back (pair);
+    }
+
+    if (pairs.empty())
+        pairs.push_back ({});
+
+    return pairs;
+}
+
+void MacroMorphFXProcessor::PairChain::prepare (const juce::dsp::ProcessSpec& spec)
+{
     filterModule.prepare (spec);
     driveModule.prepare (spec);
     delayModule.prepare (spec);
     reverbModule.prepare (spec);
 
-    outputGain.prepare (spec);
-    outputGain.setRampDurationSeconds (0.02);
+    for (auto* router : { &filterRoute, &driveRoute, &delayRoute, &reverbRoute })
+        router->prepare (spec);
+}
 
-    dryBuffer.setSize (static_cast<int> (spec.numChannels),
-                       static_cast<int> (spec.maximumBlockSize));
+void MacroMorphFXProcessor::PairChain::changeSampleRate (const juce::dsp::ProcessSpec& spec)
+{
+    filterModule.changeSampleRate (spec);
+    driveModule.changeSampleRate (spec);
+    delayModule.changeSampleRate (spec);
+    reverbModule.changeSampleRate (spec);
 
-    // Initialise parameter smoothers with per-SPEC smoothing times
-    for (int i = 0; i < SceneParam::kCount; ++i)
-    {
-        smoothScene_[static_cast<size_t> (i)].reset (sampleRate,
-                                                      getSceneParamSmoothTimeSec (i));
-        smoothScene_[static_cast<size_t> (i)].setCurrentAndTargetValue (
-            SceneParam::info[static_cast<size_t> (i)].defaultVal);
-    }
+    for (auto* router : { &filterRoute, &driveRoute, &delayRoute, &reverbRoute })
+        router->changeSampleRate (spec);
+}
 
-    // Bypass crossfade: 10 ms per SPEC
-    bypassSmooth_.reset (sampleRate, 0.01);
-    bypassSmooth_.setCurrentAndTargetValue (0.0f);
+void MacroMorphFXProcessor::PairChain::assignBuffers (AudioArena& arena, bool freezeLoop)
+{
+    filterModule.assignBuffers (arena);
+    filterRoute.assignBuffers (arena);
+    driveModule.assignBuffers (arena);
+    driveRoute.assignBuffers (arena);
+    delayModule.assignBuffers (arena);
+    delayRoute.assignBuffers (arena);
+    reverbModule.assignBuffers (arena, freezeLoop);
+    reverbRoute.assignBuffers (arena);
 }
 
-void MacroMorphFXProcessor::releaseResources()
+void MacroMorphFXProcessor::PairChain::reset()
 {
     filterModule.reset();
     driveModule.reset();
     delayModule.reset();
     reverbModule.reset();
-    inputGain.reset();
-    outputGain.reset();
+
+    for (auto* router : { &filterRoute, &driveRoute, &delayRoute, &reverbRoute })
+        router->reset();
+}
+
+void MacroMorphFXProcessor::releaseResources()
+{
+    for (auto& pair : pairs_)
+        pair->reset();
+
+    inputGain.setCurrentAndTargetValue (inputGain.getTargetValue());
+    outputGain.setCurrentAndTargetValue (outputGain.getTargetValue());
 }
 
 bool MacroMorphFXProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
 {
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Mono, stereo, surround (5.1, 7.1, 7.1.4, ...) or discrete: speaker
+    // pairs run in stereo, every other channel on the mono path
+    const auto mainSet = layouts.getMainOutputChannelSet();
+
+    if (mainSet.isDisabled() || mainSet.size() > kMaxBusChannels)
         return false;
 
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
         return false;
 
+    // Optional sidechain (envelope follower source only): off, mono or stereo
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto sidechainSet = layouts.getChannelSet (true, 1);
+
+        if (! sidechainSet.isDisabled()
+         && sidechainSet != juce::AudioChannelSet::mono()
+         && sidechainSet != juce::AudioChannelSet::stereo())
+            return false;
+    }
+
     return true;
 }
 
-void MacroMorphFXProcessor::processBlock (juce::AudioBuffer<float>& buffer,
+void MacroMorphFXProcessor::resetQuantumFifo()
+{
+    for (auto& fifo : quantumFifo_)
+        fifo.clear();
+
+    quantumSidechain_.clear();
+    quantumMidi_.clear();
+    quantumFifoIn_ = 0;
+    quantumPos_    = 0;
+}
+
+void MacroMorphFXProcessor::processBlock (juce::AudioBuffer<float>& hostBuffer,
                                           juce::MidiBuffer& midiMessages)
 {
-    juce::ignoreUnused (midiMessages);
     juce::ScopedNoDenormals noDenormals;
 
-    auto totalNumInputChannels  = getTotalNumInputChannels();
-    auto totalNumOutputChannels = getTotalNumOutputChannels();
+    // Main bus is processed in place; the sidechain only feeds the envelope
+    // follower (no channels if the host dropped the bus)
+    auto buffer    = getBusBuffer (hostBuffer, false, 0);
+    auto sidechain = getBusCount (true) > 1 ? getBusBuffer (hostBuffer, true, 1)
+                                            : juce::AudioBuffer<float>();
+
+    auto totalNumInputChannels  = getMainBusNumInputChannels();
+    auto totalNumOutputChannels = getMainBusNumOutputChannels();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
+    // ── Host transport: one playhead read per block, cached snapshot ─────
+    const auto& transport = hostTransport_.update (getPlayHead(), buffer.getNumSamples());
+
+    // ── Processing quantum: host blocks directly, or fixed chunks via FIFO ─
+    const int quantum = quantumForChoice (static_cast<int> (getRawParam (apvts, Params::ID::procQuantum)));
+
+    if (quantum != quantum_)
+    {
+        quantum_ = quantum;
+        resetQuantumFifo();
+        quantumLatency_ = quantum;   // reported by timerCallback on the message thread
+    }
+
+    if (quantum_ == 0)
+    {
+        processChunk (buffer, sidechain, midiMessages, transport);
+        return;
+    }
+
+    // Each host sample goes into the input FIFO and is replaced by the sample
+    // one quantum older from the output FIFO.  A full input FIFO is processed
+    // in place and becomes the output FIFO (the two swap roles).
+    const int numSamples   = buffer.getNumSamples();
+    const int numChannels  = std::min (buffer.getNumChannels(), quantumFifo_[0].getNumChannels());
+    const int numSidechain = std::min (sidechain.getNumChannels(), quantumSidechain_.getNumChannels());
+
+    for (int pos = 0; pos < numSamples;)
+    {
+        const int n = std::min (numSamples - pos, quantum_ - quantumPos_);
+        auto& fifoIn  = quantumFifo_[static_cast<size_t> (quantumFifoIn_)];
+        auto& fifoOut = quantumFifo_[static_cast<size_t> (1 - quantumFifoIn_)];
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            fifoIn.copyFrom (ch, quantumPos_, buffer, ch, pos, n);
+            buffer.copyFrom (ch, pos, fifoOut, ch, quantumPos_, n);
+        }
+
+        for (int ch = 0; ch < numSidechain; ++ch)
+            quantumSidechain_.copyFrom (ch, quantumPos_, sidechain, ch, pos, n);
+
+        // MIDI keeps its position relative to the audio it arrived with
+        for (const auto metadata : midiMessages)
+            if (metadata.samplePosition >= pos && metadata.samplePosition < pos + n)
+                quantumMidi_.addEvent (metadata.getMessage(), metadata.samplePosition - pos + quantumPos_);
+
+        quantumPos_ += n;
+        pos += n;
+
+        if (quantumPos_ == quantum_)
+        {
+            juce::AudioBuffer<float> chunk (fifoIn.getArrayOfWritePointers(), numChannels, quantum_);
+            juce::AudioBuffer<float> chunkSidechain (quantumSidechain_.getArrayOfWritePointers(), numSidechain, quantum_);
+
+            // The quantum's first sample arrived quantum_ samples before `pos`
+            processChunk (chunk, chunkSidechain, quantumMidi_, transport.shiftedBy (pos - quantum_));
+
+            quantumMidi_.clear();
+            quantumFifoIn_ = 1 - quantumFifoIn_;
+            quantumPos_ = 0;
+        }
+    }
+}
+
+void MacroMorphFXProcessor::processChunk (juce::AudioBuffer<float>& buffer,
+                                          juce::AudioBuffer<float>& sidechain,
+                                          const juce::MidiBuffer& midiMessages,
+                                          const TransportSnapshot& transport)
+{
+    auto totalNumInputChannels  = getMainBusNumInputChannels();
+    auto totalNumOutputChannels = getMainBusNumOutputChannels();
+
     // ── Read performance parameters (always from APVTS) ─────────────────
     using namespace Params::ID;
 
     const bool bypassed = getRawParam (apvts, bypass) > 0.5f;
     bypassSmooth_.setTargetValue (bypassed ? 1.0f : 0.0f);
 
-    // If fully bypassed and settled, skip all processing (saves CPU)
+    // If fully bypassed and settled, skip all processing (saves CPU).  Events
+    // are still taken, so scene / morph changes made while bypassed hold
+    // when it is released and the queue can't fill up.
     if (! bypassSmooth_.isSmoothing() && bypassSmooth_.getCurrentValue() > 0.999f)
     {
+        const int numEvents = gatherParamEvents (midiMessages);
+
+        for (int i = 0; i < numEvents; ++i)
+        {
+            const auto& ev = blockEvents_[static_cast<size_t> (i)];
+            perfState_.values[ev.param] = ev.value;
+        }
+
         bypassSmooth_.skip (buffer.getNumSamples());
         return;
     }
@@ -247,122 +697,278 @@ void MacroMorphFXProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     const float inGainDb  = getRawParam (apvts, inputGainDb);
     const float outGainDb = getRawParam (apvts, outputGainDb);
     const float mixAmount = getRawParam (apvts, mix);
+    const auto  autoGain  = static_cast<DriveAutoGain> (static_cast<int> (getRawParam (apvts, driveAutoGain)));
 
-    // ── Scene / Morph / Macro pipeline ───────────────────────────────────
-    const int sceneAIdx = std::clamp (static_cast<int> (getRawParam (apvts, sceneA)), 0, kNumScenes - 1);
-    const int sceneBIdx = std::clamp (static_cast<int> (getRawParam (apvts, sceneB)), 0, kNumScenes - 1);
-    const float morphVal = getRawParam (apvts, morph);
-
-    // 1. Morph between scene A and scene B
-    SceneParams morphed = SceneParams::morph (scenes_[static_cast<size_t> (sceneAIdx)],
-                                              scenes_[static_cast<size_t> (sceneBIdx)],
-                                              morphVal);
-
-    // 2. Apply macro offsets
-    const float macroValues[MacroEngine::kNumMacros] = {
-        getRawParam (apvts, macro1),
-        getRawParam (apvts, macro2),
-        getRawParam (apvts, macro3),
-        getRawParam (apvts, macro4)
-    };
-    macroEngine_.apply (morphed, macroValues);
+    // M/S needs a channel pair; a mono bus always runs L/R
+    const bool midSide = static_cast<int> (getRawParam (apvts, stereoMode)) == static_cast<int> (StereoMode::midSide)
+                      && totalNumInputChannels >= 2 && buffer.getNumChannels() >= 2;
 
-    // 3. Smooth scene parameters to avoid clicks during morph transitions
-    const int numSamples = buffer.getNumSamples();
+    // Parallel: Delay and Reverb both fed from the signal ahead of the first of them
+    const bool parallel = getRawParam (apvts, fxRouting) > 0.5f;
 
-    for (int i = 0; i < SceneParam::kCount; ++i)
-    {
-        auto idx = static_cast<size_t> (i);
+    // Module order: one table lookup, the chain itself is fixed at compile time
+    const auto orderedChain = chainTable_[static_cast<size_t> (std::clamp (static_cast<int> (getRawParam (apvts, chainOrder)),
+                                                                           0, kNumChainOrders - 1))];
+
+    // ── Scene / Morph / Macro inputs: timestamped events for this block ──
+    const int numEvents = gatherParamEvents (midiMessages);
 
-        if (SceneParam::info[idx].isDiscrete)
-            smoothScene_[idx].setCurrentAndTargetValue (morphed.values[i]);
-        else
-            smoothScene_[idx].setTargetValue (morphed.values[i]);
+    const double bpm = transport.bpm;
 
-        smoothScene_[idx].skip (numSamples);
+    // Phase-lock LFOs to the grid while the transport runs
+    if (transport.isPlaying)
+        lfoBank_.syncToHost (transport.ppq);
+
+    // ── LFO configuration (block rate; evaluated at control rate below) ──
+    for (int i = 0; i < LfoBank::kNumLfos; ++i)
+    {
+        const auto idx = static_cast<size_t> (i);
+        lfoBank_.setLfo (i,
+                         static_cast<LfoShape> (static_cast<int> (getRawParam (apvts, lfoShape[idx]))),
+                         static_cast<int> (getRawParam (apvts, lfoRate[idx])),
+                         getRawParam (apvts, lfoDepth[idx]),
+                         static_cast<ModTarget> (static_cast<int> (getRawParam (apvts, lfoTarget[idx]))));
     }
 
-    // 4. Read smoothed values and store for UI
-    SceneParams smoothed;
-    for (int i = 0; i < SceneParam::kCount; ++i)
-        smoothed.values[i] = smoothScene_[static_cast<size_t> (i)].getCurrentValue();
+    // ── Envelope follower configuration (main input + sidechain) ────────
+    ModTarget envTargets[EnvelopeFollower::kNumSources];
+    float     envDepths[EnvelopeFollower::kNumSources];
+
+    for (int e = 0; e < EnvelopeFollower::kNumSources; ++e)
+    {
+        const auto idx = static_cast<size_t> (e);
+        envFollower_.setParameters (static_cast<EnvelopeFollower::Source> (e),
+                                    getRawParam (apvts, envAttack[idx]),
+                                    getRawParam (apvts, envRelease[idx]),
+                                    static_cast<EnvelopeFollower::Mode> (static_cast<int> (getRawParam (apvts, envMode[idx]))));
+        envTargets[e] = static_cast<ModTarget> (static_cast<int> (getRawParam (apvts, envTarget[idx])));
+        envDepths[e]  = getRawParam (apvts, envDepth[idx]);
+    }
 
-    lastComputedParams_ = smoothed;  // publish for UI (safe: single-writer)
+    const int numSidechainChannels = std::min (sidechain.getNumChannels(), 2);
 
-    // 5. Extract final DSP values from the smoothed scene
-    const int   filtModeVal    = static_cast<int> (smoothed.values[SceneParam::filtMode]);
-    const float filtCutoffHz   = smoothed.values[SceneParam::filtCutoff];
-    const float filtResoVal    = smoothed.values[SceneParam::filtReso];
-    const float driveAmtVal    = smoothed.values[SceneParam::driveAmt];
-    const float driveToneVal   = smoothed.values[SceneParam::driveTone];
-    const int   delaySyncVal   = static_cast<int> (smoothed.values[SceneParam::delaySync]);
-    const float delayFbVal     = smoothed.values[SceneParam::delayFb];
-    const float delayToneVal   = smoothed.values[SceneParam::delayTone];
-    const float delayWidthVal  = smoothed.values[SceneParam::delayWidth];
-    const bool  delayPPVal     = smoothed.values[SceneParam::delayPingP] > 0.5f;
-    const float revSizeVal     = smoothed.values[SceneParam::revSize];
-    const float revDampVal     = smoothed.values[SceneParam::revDamp];
-    const float revPreDelayVal = smoothed.values[SceneParam::revPreDelay];
-    const float revWidthVal    = smoothed.values[SceneParam::revWidth];
+    const int numSamples = buffer.getNumSamples();
 
-    // ── Get BPM from host ────────────────────────────────────────────────
-    double bpm = 120.0;
-    if (auto* ph = getPlayHead())
+    // Order events by offset (insertion sort: few events, usually already sorted)
+    for (int i = 0; i < numEvents; ++i)
     {
-        auto posInfo = ph->getPosition();
-        if (posInfo.hasValue())
-        {
-            auto bpmOpt = posInfo->getBpm();
-            if (bpmOpt.hasValue())
-                bpm = *bpmOpt;
-        }
+        auto ev = blockEvents_[static_cast<size_t> (i)];
+        ev.sampleOffset = std::clamp (ev.sampleOffset, 0, std::max (0, numSamples - 1));
+
+        int j = i;
+        for (; j > 0 && blockEvents_[static_cast<size_t> (j - 1)].sampleOffset > ev.sampleOffset; --j)
+            blockEvents_[static_cast<size_t> (j)] = blockEvents_[static_cast<size_t> (j - 1)];
+
+        blockEvents_[static_cast<size_t> (j)] = ev;
     }
 
     // ── Save dry signal for mix ──────────────────────────────────────────
     for (int ch = 0; ch < totalNumInputChannels; ++ch)
-        dryBuffer.copyFrom (ch, 0, buffer, ch, 0, buffer.getNumSamples());
+        dryBuffer.copyFrom (ch, 0, buffer, ch, 0, numSamples);
 
     // ── Signal chain ─────────────────────────────────────────────────────
     juce::dsp::AudioBlock<float> block (buffer);
-    juce::dsp::ProcessContextReplacing<float> context (block);
+    auto sendBlock = juce::dsp::AudioBlock<float> (reverbSend).getSubsetChannelBlock (0, block.getNumChannels());
 
-    // 1. Input Gain
-    inputGain.setGainDecibels (inGainDb);
-    inputGain.process (context);
+    // 1. Input Gain (+ L/R → M/S encode in the same pass, per channel pair)
+    inputGain.setTargetValue (juce::Decibels::decibelsToGain (inGainDb));
 
-    // 2. Filter
-    filterModule.setParameters (filtModeVal, filtCutoffHz, filtResoVal);
-    filterModule.process (context);
+    if (midSide)
+    {
+        const int numChannels = buffer.getNumChannels();
 
-    // 3. Drive
-    driveModule.setParameters (driveAmtVal, driveToneVal);
-    driveModule.process (block);
+        for (const auto& pair : pairs_)
+        {
+            const auto& c = pair->channels;
+            auto gain = inputGain;   // the same ramp on every pair
+
+            if (! c.fits (numChannels))
+                continue;
 
-    // 4. Delay
-    delayModule.setParameters (delaySyncVal, delayFbVal, delayToneVal,
-                               delayWidthVal, delayPPVal, bpm);
-    delayModule.process (buffer);
+            if (c.isStereo())
+                MidSide::encode (buffer.getWritePointer (c.first), buffer.getWritePointer (c.second), numSamples, gain);
+            else
+                MidSide::applyGain (buffer.getWritePointer (c.first), numSamples, gain);
+        }
+
+        inputGain.skip (numSamples);
+    }
+    else
+    {
+        MidSide::applyGain (buffer, buffer.getNumChannels(), numSamples, inputGain);
+    }
 
-    // 5. Reverb
-    reverbModule.setParameters (revSizeVal, revDampVal, revPreDelayVal, revWidthVal);
-    reverbModule.process (block);
+    // Control rate: modulation, morph, macros and smoothing are computed once
+    // per control block, so their resolution doesn't depend on the host
+    // buffer size, and shared by every channel pair.  A control block also
+    // ends at the next parameter event, so the event applies from its exact
+    // sample.
+    int numControlBlocks = 0;
+    int nextEvent = 0;
 
-    // 6. Mix (dry/wet blend)
-    if (mixAmount < 1.0f)
+    for (int start = 0; start < numSamples;)
     {
-        for (int ch = 0; ch < totalNumInputChannels; ++ch)
+        for (; nextEvent < numEvents && blockEvents_[static_cast<size_t> (nextEvent)].sampleOffset <= start; ++nextEvent)
+        {
+            const auto& ev = blockEvents_[static_cast<size_t> (nextEvent)];
+            perfState_.values[ev.param] = ev.value;
+        }
+
+        int end = std::min (start + kControlBlockSize, numSamples);
+        if (nextEvent < numEvents)
+            end = std::min (end, blockEvents_[static_cast<size_t> (nextEvent)].sampleOffset);
+
+        const int len = end - start;
+
+        jassert (numControlBlocks < static_cast<int> (controlBlocks_.size()));
+        auto& cb = controlBlocks_[static_cast<size_t> (numControlBlocks++)];
+        cb.start  = start;
+        cb.length = len;
+        cb.ppq    = transport.ppqAt (start);
+
+        const MorphPosition morphPos = toMorphPosition (perfState_);
+
+        // a. Internal modulation (LFOs + envelope followers on dry input / sidechain)
+        ModOffsets mod;
+        lfoBank_.process (len, bpm, mod);
+
+        const float* envChannels[4] = {
+            totalNumInputChannels > 0 ? dryBuffer.getReadPointer (0, start) : nullptr,
+            totalNumInputChannels > 1 ? dryBuffer.getReadPointer (1, start) : nullptr,
+            numSidechainChannels  > 0 ? sidechain.getReadPointer (0, start) : nullptr,
+            numSidechainChannels  > 1 ? sidechain.getReadPointer (1, start) : nullptr
+        };
+        envFollower_.process (envChannels, len);
+
+        for (int e = 0; e < EnvelopeFollower::kNumSources; ++e)
+            if (envTargets[e] != ModTarget::off)
+                mod.add (envTargets[e], envDepths[e]
+                                      * envFollower_.getLevel01 (static_cast<EnvelopeFollower::Source> (e)));
+
+        MorphPosition modPos = morphPos;
+        modPos.morph = std::clamp (morphPos.morph + mod.morph,  0.0f, 1.0f);
+        modPos.x     = std::clamp (morphPos.x     + mod.morphX, 0.0f, 1.0f);
+        modPos.y     = std::clamp (morphPos.y     + mod.morphY, 0.0f, 1.0f);
+
+        float modMacros[MacroEngine::kNumMacros];
+        for (int m = 0; m < MacroEngine::kNumMacros; ++m)
+            modMacros[m] = std::clamp (perfState_.values[PerfParam::macro1 + m] + mod.macros[m], 0.0f, 1.0f);
+
+        // b. Morph: A/B, or weighted blend of several scenes (XY / Ring)
+        SceneParams morphed = vectorMorph_.process (scenes_, modPos);
+
+        // c. Apply macro offsets
+        macroEngine_.apply (morphed, modMacros);
+
+        // d. Smooth scene parameters to avoid clicks during morph transitions
+        for (int i = 0; i < SceneParam::kCount; ++i)
         {
-            auto* wet = buffer.getWritePointer (ch);
-            const auto* dry = dryBuffer.getReadPointer (ch);
+            auto idx = static_cast<size_t> (i);
+
+            if (SceneParam::info[idx].isDiscrete)
+                smoothScene_[idx].setCurrentAndTargetValue (morphed.values[i]);
+            else
+                smoothScene_[idx].setTargetValue (morphed.values[i]);
+
+            cb.params.values[i] = smoothScene_[idx].skip (len);
+        }
+
+        start = end;
+    }
+
+    if (numControlBlocks > 0)
+        lastComputedParams_ = controlBlocks_[static_cast<size_t> (numControlBlocks - 1)].params;  // publish for UI (safe: single-writer)
+
+    // 2–5. Modules (chainOrder), per channel pair over the control blocks.
+    //      Offline, pairs 1.. run on the worker pool while this thread runs pair 0.
+    pairPass_.block            = block;
+    pairPass_.send             = sendBlock;
+    pairPass_.chain            = orderedChain;
+    pairPass_.numControlBlocks = numControlBlocks;
+    pairPass_.autoGain         = autoGain;
+    pairPass_.bpm              = bpm;
+    pairPass_.midSide          = midSide;
+    pairPass_.parallel         = parallel;
+    pairPass_.freezeLoop       = getRawParam (apvts, freezeLoop) > 0.5f;
+
+    const int numPairs = static_cast<int> (pairs_.size());   // processPair skips pairs the buffer lacks
+    const bool useWorkers = numPairs > 1 && pairPool_ != nullptr && isNonRealtime()
+                         && getRawParam (apvts, offlineThreads) > 0.5f;
+
+    if (useWorkers)
+    {
+        for (int p = 1; p < numPairs; ++p)
+            pairPool_->addJob (pairJobs_[static_cast<size_t> (p)].get(), false);
+
+        processPair (0);
+
+        for (int p = 1; p < numPairs; ++p)
+            pairPool_->waitForJobToFinish (pairJobs_[static_cast<size_t> (p)].get(), -1);
+    }
+    else
+    {
+        for (int p = 0; p < numPairs; ++p)
+            processPair (p);
+    }
+
+    outputGain.setTargetValue (juce::Decibels::decibelsToGain (outGainDb));
+
+    if (midSide)
+    {
+        // 6–7. M/S → L/R decode, mix and output gain in one pass per channel pair
+        const int numChannels = buffer.getNumChannels();
 
-            for (int s = 0; s < numSamples; ++s)
-                wet[s] = dry[s] + mixAmount * (wet[s] - dry[s]);
+        for (const auto& pair : pairs_)
+        {
+            const auto& c = pair->channels;
+            auto gain = outputGain;   // the same ramp on every pair
+
+            if (! c.fits (numChannels))
+                continue;
+
+            if (c.isStereo())
+                MidSide::decodeMix (buffer.getWritePointer (c.first), buffer.getWritePointer (c.second),
+                                    dryBuffer.getReadPointer (c.first), dryBuffer.getReadPointer (c.second),
+                                    numSamples, mixAmount, gain,
+                                    parallel ? reverbSend.getReadPointer (c.first) : nullptr,
+                                    parallel ? reverbSend.getReadPointer (c.second) : nullptr);
+            else
+                MidSide::mixSingle (buffer.getWritePointer (c.first), dryBuffer.getReadPointer (c.first), numSamples,
+                                    mixAmount, gain, parallel ? reverbSend.getReadPointer (c.first) : nullptr);
         }
+
+        outputGain.skip (numSamples);
     }
+    else
+    {
+        // 6. Mix (dry/wet blend; parallel routing sums the reverb return here)
+        if (parallel)
+        {
+            for (int ch = 0; ch < totalNumInputChannels; ++ch)
+            {
+                auto* wet = buffer.getWritePointer (ch);
+                const auto* ret = reverbSend.getReadPointer (ch);
+                const auto* dry = dryBuffer.getReadPointer (ch);
+
+                for (int s = 0; s < numSamples; ++s)
+                    wet[s] = dry[s] + mixAmount * (wet[s] + ret[s] - dry[s]);
+            }
+        }
+        else if (mixAmount < 1.0f)
+        {
+            for (int ch = 0; ch < totalNumInputChannels; ++ch)
+            {
+                auto* wet = buffer.getWritePointer (ch);
+                const auto* dry = dryBuffer.getReadPointer (ch);
 
-    // 7. Output Gain
-    outputGain.setGainDecibels (outGainDb);
-    outputGain.process (context);
+                for (int s = 0; s < numSamples; ++s)
+                    wet[s] = dry[s] + mixAmount * (wet[s] - dry[s]);
+            }
+        }
+
+        // 7. Output Gain
+        MidSide::applyGain (buffer, buffer.getNumChannels(), numSamples, outputGain);
+    }
 
     // 8. Bypass crossfade (10 ms click-free, per SPEC)
     if (bypassSmooth_.isSmoothing() || bypassSmooth_.getCurrentValue() > 0.001f)
@@ -388,6 +994,264 @@ void MacroMorphFXProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     }
 }
 
+int MacroMorphFXProcessor::gatherParamEvents (const juce::MidiBuffer& midiMessages)
+{
+    using namespace Params::ID;
+
+    // Queue overflowed: everything still queued is older than the APVTS, so
+    // it is discarded before reloading (the dropped change is in the APVTS)
+    if (perfResync_.exchange (false))
+    {
+        ParamEvent stale;
+        while (paramEvents_.pop (stale)) {}
+        readPerfState (perfState_);
+    }
+
+    int numEvents = 0;
+    while (numEvents < kMaxEventsPerBlock / 2 && paramEvents_.pop (blockEvents_[static_cast<size_t> (numEvents)]))
+        ++numEvents;
+
+    // MIDI: notes / CCs become events at their own sample offset
+    const int midiChannelSetting = static_cast<int> (getRawParam (apvts, midiChannel));
+    bool reflectMidi = false;
+
+    for (const auto metadata : midiMessages)
+    {
+        const auto msg = metadata.getMessage();
+
+        if (! MidiMapping::acceptsChannel (msg, midiChannelSetting))
+            continue;
+
+        if (msg.isProgramChange())
+        {
+            pendingProgram_ = msg.getProgramChangeNumber();
+            reflectMidi = true;
+            continue;
+        }
+
+        ParamEvent ev;
+        if (numEvents < kMaxEventsPerBlock
+            && MidiMapping::toEvent (msg, metadata.samplePosition, ev))
+        {
+            blockEvents_[static_cast<size_t> (numEvents++)] = ev;
+
+            midiValues_[static_cast<size_t> (ev.param)] = ev.value;
+            midiDirty_[static_cast<size_t> (ev.param)]  = true;
+            reflectMidi = true;
+        }
+    }
+
+    if (reflectMidi)
+        midiPending_.store (true, std::memory_order_release);   // picked up by timerCallback
+
+    return numEvents;
+}
+
+//==============================================================================
+void MacroMorphFXProcessor::processPair (int pairIndex)
+{
+    const auto& pass = pairPass_;
+    auto& pair = *pairs_[static_cast<size_t> (pairIndex)];
+
+    const auto& c = pair.channels;
+
+    if (! c.fits (static_cast<int> (pass.block.getNumChannels())))
+        return;
+
+    // The pair's channels need not be adjacent (e.g. top front L / R around
+    // top front C), so the blocks refer to them through pointer arrays
+    const auto numChannels = static_cast<size_t> (c.isStereo() ? 2 : 1);
+
+    float* mainChannels[2] = { pass.block.getChannelPointer (static_cast<size_t> (c.first)), nullptr };
+    float* sendChannels[2] = { pass.send.getChannelPointer (static_cast<size_t> (c.first)), nullptr };
+
+    if (c.isStereo())
+    {
+        mainChannels[1] = pass.block.getChannelPointer (static_cast<size_t> (c.second));
+        sendChannels[1] = pass.send.getChannelPointer (static_cast<size_t> (c.second));
+    }
+
+    juce::dsp::AudioBlock<float> pairBlock (mainChannels, numChannels, pass.block.getNumSamples());
+    juce::dsp::AudioBlock<float> pairSend  (sendChannels, numChannels, pass.send.getNumSamples());
+
+    // A channel on the mono path has no M/S pair: its routes stay Both
+    const bool midSide = pass.midSide && c.isStereo();
+
+    for (int i = 0; i < pass.numControlBlocks; ++i)
+    {
+        const auto& cb = controlBlocks_[static_cast<size_t> (i)];
+        const auto start = static_cast<size_t> (cb.start);
+        const auto len   = static_cast<size_t> (cb.length);
+
+        // Modules are prepared for one control block (scratch, ER sums)
+        jassert (len <= static_cast<size_t> (kControlBlockSize));
+
+        StageContext ctx { pair, pairBlock.getSubBlock (start, len), pairSend.getSubBlock (start, len),
+                           cb.params, pass.autoGain, cb.ppq, pass.bpm, midSide, pass.parallel, pass.freezeLoop, false };
+
+        (this->*pass.chain) (ctx);
+    }
+}
+
+juce::ThreadPoolJob::JobStatus MacroMorphFXProcessor::PairJob::runJob()
+{
+    juce::ScopedNoDenormals noDenormals;
+    owner.processPair (pair);
+    return jobHasFinished;
+}
+
+//==============================================================================
+// Module stages: one control block each.  runChain<...> calls them in a fixed
+// order; chainTable_ holds one instantiation per entry of kChainOrders.
+
+MsRoute MacroMorphFXProcessor::routeFor (const StageContext& ctx, int param)
+{
+    // M/S routes apply in M/S mode only (Both in L/R)
+    if (! ctx.midSide)
+        return MsRoute::both;
+
+    return static_cast<MsRoute> (std::clamp (static_cast<int> (ctx.params.values[param]), 0,
+                                             static_cast<int> (MsRoute::kCount) - 1));
+}
+
+void MacroMorphFXProcessor::tapReverbSend (StageContext& ctx)
+{
+    // Parallel: the reverb gets a copy of the signal ahead of the first of Delay / Reverb
+    if (ctx.parallel && ! ctx.sendTapped)
+    {
+        ctx.send.copyFrom (ctx.block);
+        ctx.sendTapped = true;
+    }
+}
+
+void MacroMorphFXProcessor::processFilterStage (StageContext& ctx)
+{
+    const auto& v = ctx.params.values;
+    const int   mode     = static_cast<int> (v[SceneParam::filtMode]);
+    const float cutoffHz = v[SceneParam::filtCutoff];
+    const float reso     = v[SceneParam::filtReso];
+
+    // Mode changes crossfade between two instances
+    ctx.pair.filterRoute.process (ctx.block, routeFor (ctx, SceneParam::filtRoute), [&] (juce::dsp::AudioBlock<float>& b)
+    {
+        ctx.pair.filterModule.process (b, mode, [&] (FilterModule& m, int key)
+        {
+            m.setParameters (key, cutoffHz, reso);
+        });
+    });
+}
+
+void MacroMorphFXProcessor::processDriveStage (StageContext& ctx)
+{
+    const auto& v = ctx.params.values;
+    const int   curve  = static_cast<int> (v[SceneParam::driveCurve]);
+    const float amount = v[SceneParam::driveAmt];
+    const float tone   = v[SceneParam::driveTone];
+
+    DriveModule::CrushParams crush;
+    crush.bits       = v[SceneParam::crushBits];
+    crush.downsample = v[SceneParam::crushRate];
+    crush.dither     = v[SceneParam::crushDither] > 0.5f;
+
+    // Curve changes crossfade between two instances
+    ctx.pair.driveRoute.process (ctx.block, routeFor (ctx, SceneParam::driveRoute), [&] (juce::dsp::AudioBlock<float>& b)
+    {
+        ctx.pair.driveModule.process (b, curve, [&] (DriveModule& m, int key)
+        {
+            m.setParameters (key, amount, tone, crush, ctx.autoGain);
+        });
+    });
+}
+
+void MacroMorphFXProcessor::processDelayStage (StageContext& ctx)
+{
+    tapReverbSend (ctx);
+
+    const auto& v = ctx.params.values;
+    const int   sync     = static_cast<int> (v[SceneParam::delaySync]);
+    const float fb       = v[SceneParam::delayFb];
+    const float tone     = v[SceneParam::delayTone];
+    const float width    = v[SceneParam::delayWidth];
+    const bool  pingPong = v[SceneParam::delayPingP] > 0.5f;
+    const bool  freeTime = v[SceneParam::delayMode] > 0.5f;
+    const float timeMs   = v[SceneParam::delayTime];
+    const float level    = ctx.parallel ? v[SceneParam::delayLevel] : 1.0f;
+
+    DelayModule::TapeParams tape;
+    tape.wow        = v[SceneParam::delayWow];
+    tape.flutter    = v[SceneParam::delayFlutter];
+    tape.drift      = v[SceneParam::delayDrift];
+    tape.saturation = v[SceneParam::delaySat];
+    tape.diffuse    = v[SceneParam::delayDiffuse];
+
+    // Mode / sync / ping-pong changes crossfade between two instances;
+    // in free mode the sync value is ignored, so it isn't part of the key
+    const int delayKey = (freeTime ? kDelayFreeKey : sync * 2) + (pingPong ? 1 : 0);
+
+    ctx.pair.delayRoute.process (ctx.block, routeFor (ctx, SceneParam::delayRoute), [&] (juce::dsp::AudioBlock<float>& b)
+    {
+        ctx.pair.delayModule.process (b, delayKey, [&] (DelayModule& m, int key)
+        {
+            const bool free = key >= kDelayFreeKey;
+            m.setParameters (free, free ? 0 : key / 2, timeMs, fb, tone,
+                             width, (key % 2) != 0, tape, ctx.ppq, ctx.bpm);
+            m.setWetLevel (level);
+        });
+    });
+}
+
+void MacroMorphFXProcessor::processReverbStage (StageContext& ctx)
+{
+    tapReverbSend (ctx);
+
+    const auto& v = ctx.params.values;
+    ctx.pair.reverbModule.setParameters (v[SceneParam::revSize], v[SceneParam::revDamp],
+                                         v[SceneParam::revPreDelay], v[SceneParam::revWidth],
+                                         ctx.parallel ? v[SceneParam::revLevel] : 1.0f,
+                                         v[SceneParam::revFreeze] > 0.5f,
+                                         v[SceneParam::revEarly], static_cast<int> (v[SceneParam::revRoom]));
+    ctx.pair.reverbModule.setFreezeLoop (ctx.freezeLoop);
+
+    // Serial: in the chain.  Parallel: on the send copy, whose return is
+    // summed in the mix pass.
+    auto& target = ctx.parallel ? ctx.send : ctx.block;
+
+    ctx.pair.reverbRoute.process (target, routeFor (ctx, SceneParam::revRoute), [&] (juce::dsp::AudioBlock<float>& b)
+    {
+        ctx.pair.reverbModule.process (b);
+    });
+}
+
+template <int Stage>
+void MacroMorphFXProcessor::runStage (StageContext& ctx)
+{
+    if constexpr (Stage == ChainStage::filter)
+        processFilterStage (ctx);
+    else if constexpr (Stage == ChainStage::drive)
+        processDriveStage (ctx);
+    else if constexpr (Stage == ChainStage::delay)
+        processDelayStage (ctx);
+    else
+        processReverbStage (ctx);
+}
+
+template <int... Stages>
+void MacroMorphFXProcessor::runChain (StageContext& ctx)
+{
+    (runStage<Stages> (ctx), ...);
+}
+
+template <size_t... Orders>
+std::array<MacroMorphFXProcessor::ChainFn, sizeof... (Orders)>
+MacroMorphFXProcessor::makeChainTable (std::index_sequence<Orders...>)
+{
+    return { { &MacroMorphFXProcessor::runChain<kChainOrders[Orders][0], kChainOrders[Orders][1],
+                                                 kChainOrders[Orders][2], kChainOrders[Orders][3]>... } };
+}
+
+const std::array<MacroMorphFXProcessor::ChainFn, kNumChainOrders> MacroMorphFXProcessor::chainTable_
+    = MacroMorphFXProcessor::makeChainTable (std::make_index_sequence<kNumChainOrders>());
+
 //==============================================================================
 bool MacroMorphFXProcessor::hasEditor() const
 {
@@ -473,9 +1337,9 @@ void MacroMorphFXProcessor::setStateInformation (const void* data, int sizeInByt
                     const auto& inf = SceneParam::info[static_cast<size_t> (p)];
                     juce::String attrName (inf.id.data(), inf.id.size());
 
-                    if (sceneXml->hasAttribute (attrName))
-                        scenes_[static_cast<size_t> (idx)].values[p] =
-                            static_cast<float> (sceneXml->getDoubleAttribute (attrName));
+                    // Params missing from older saves load at their defaults
+                    scenes_[static_cast<size_t> (idx)].values[p] =
+                        static_cast<float> (sceneXml->getDoubleAttribute (attrName, inf.defaultVal));
                 }
             }
         }
@@ -532,8 +1396,7 @@ void MacroMorphFXProcessor::loadFactoryPresetData (int index)
     if (index < 0 || index >= kNumFactoryPresets)
         return;
 
-    auto presets = createFactoryPresets();
-    const auto& preset = presets[static_cast<size_t> (index)];
+    const auto& preset = factoryPresets_->presets[static_cast<size_t> (index)];
 
     // Load scenes
     scenes_ = preset.scenes;
@@ -571,10 +1434,116 @@ void MacroMorphFXProcessor::loadFactoryPreset (int index)
     setParam (macro4,      0.f);
     setParam (sceneA,      0.f);
     setParam (sceneB,      1.f);
+    setParam (sceneC,      2.f);
+    setParam (sceneD,      3.f);
+    setParam (morphX,      0.5f);
+    setParam (morphY,      0.5f);
     setParam (mix,         1.f);
     setParam (inputGainDb, 0.f);
     setParam (outputGainDb,0.f);
     setParam (bypass,      0.f);
+
+    // Module order is part of the preset
+    if (index >= 0 && index < kNumFactoryPresets)
+        setParam (chainOrder, static_cast<float> (factoryPresets_->presets[static_cast<size_t> (index)].chainOrder));
+}
+
+MorphPosition MacroMorphFXProcessor::readMorphPosition() const
+{
+    PerfState state;
+    readPerfState (state);
+    return toMorphPosition (state);
+}
+
+void MacroMorphFXProcessor::readPerfState (PerfState& state) const
+{
+    for (int p = 0; p < PerfParam::kCount; ++p)
+        state.values[p] = getRawParam (apvts, PerfParam::ids[static_cast<size_t> (p)]);
+}
+
+MorphPosition MacroMorphFXProcessor::toMorphPosition (const PerfState& state)
+{
+    auto sceneIndex = [&state] (int p)
+    {
+        return std::clamp (static_cast<int> (state.values[p]), 0, kNumScenes - 1);
+    };
+
+    MorphPosition pos;
+    pos.mode       = static_cast<MorphMode> (std::clamp (static_cast<int> (state.values[PerfParam::morphMode]),
+                                                         0, static_cast<int> (MorphMode::kCount) - 1));
+    pos.scenes[0]  = sceneIndex (PerfParam::sceneA);
+    pos.scenes[1]  = sceneIndex (PerfParam::sceneB);
+    pos.scenes[2]  = sceneIndex (PerfParam::sceneC);
+    pos.scenes[3]  = sceneIndex (PerfParam::sceneD);
+    pos.morph      = state.values[PerfParam::morph];
+    pos.x          = state.values[PerfParam::morphX];
+    pos.y          = state.values[PerfParam::morphY];
+    pos.ringScenes = kMinRingScenes + static_cast<int> (state.values[PerfParam::ringScenes]);
+    return pos;
+}
+
+// Set while the message thread writes MIDI-driven values back to the APVTS,
+// so those echoes aren't queued (the audio thread already applied them).
+static thread_local bool isReflectingMidi = false;
+
+void MacroMorphFXProcessor::parameterChanged (const juce::String& parameterID, float newValue)
+{
+    if (isReflectingMidi)
+        return;
+
+    // Host automation arrives without its sample position, so it applies
+    // from the start of the next block.
+    for (int p = 0; p < PerfParam::kCount; ++p)
+    {
+        // IDs are string literals (null-terminated), so this compares without allocating
+        if (parameterID == PerfParam::ids[static_cast<size_t> (p)].data())
+        {
+            if (! paramEvents_.push ({ 0, p, newValue }))
+                perfResync_ = true;   // queue full: reload everything next block
+            return;
+        }
+    }
+}
+
+void MacroMorphFXProcessor::timerCallback()
+{
+    // Processing quantum changed on the audio thread → report its latency
+    if (const int latency = quantumLatency_.load(); latency != getLatencySamples())
+        setLatencySamples (latency);
+
+    // Frozen loop switched on without its buffers → lay the arena out again
+    // (a full prepare: the tails restart once)
+    if (isPrepared_ && ! loopReserved_ && getRawParam (apvts, Params::ID::freezeLoop) > 0.5f)
+    {
+        suspendProcessing (true);
+        prepareToPlay (preparedSpec_.sampleRate, static_cast<int> (preparedSpec_.maximumBlockSize));
+        suspendProcessing (false);
+    }
+
+    if (! midiPending_.exchange (false, std::memory_order_acquire))
+        return;
+
+    // Keep the APVTS (host, UI, saved state) in step with MIDI-driven values
+    isReflectingMidi = true;
+
+    for (int p = 0; p < PerfParam::kCount; ++p)
+    {
+        const auto idx = static_cast<size_t> (p);
+
+        if (! midiDirty_[idx].exchange (false))
+            continue;
+
+        const auto& id = PerfParam::ids[idx];
+        if (auto* param = apvts.getParameter (juce::String (id.data(), id.size())))
+            param->setValueNotifyingHost (param->convertTo0to1 (midiValues_[idx].load()));
+    }
+
+    isReflectingMidi = false;
+
+    // Program change → factory preset
+    const int program = pendingProgram_.exchange (-1);
+    if (program >= 0 && program < kNumFactoryPresets)
+        setCurrentProgram (program);
 }
 
 void MacroMorphFXProcessor::setSceneParam (int sceneIndex, int paramIndex, float value)
@@ -606,13 +1575,7 @@ void MacroMorphFXProcessor::storeCurrentToScene (int sceneIndex)
         return;
 
     // Recompute the current morph + macro values (same logic as processBlock)
-    const int sceneAIdx = std::clamp (static_cast<int> (getRawParam (apvts, Params::ID::sceneA)), 0, kNumScenes - 1);
-    const int sceneBIdx = std::clamp (static_cast<int> (getRawParam (apvts, Params::ID::sceneB)), 0, kNumScenes - 1);
-    const float morphVal = getRawParam (apvts, Params::ID::morph);
-
-    SceneParams morphed = SceneParams::morph (scenes_[static_cast<size_t> (sceneAIdx)],
-                                              scenes_[static_cast<size_t> (sceneBIdx)],
-                                              morphVal);
+    SceneParams morphed = vectorMorph_.process (scenes_, readMorphPosition());
 
     const float macroVals[MacroEngine::kNumMacros] = {
         getRawParam (apvts, Params::ID::macro1),
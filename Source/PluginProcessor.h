@@ -3,21 +3,66 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include "Params.h"
+#include "ParamEvents.h"
 #include "SceneData.h"
 #include "MacroEngine.h"
+#include "VectorMorph.h"
+#include "MidiMapping.h"
+#include "Modulation.h"
+#include "HostTransport.h"
 #include "DSP/FilterModule.h"
 #include "DSP/DriveModule.h"
 #include "DSP/DelayModule.h"
 #include "DSP/ReverbModule.h"
+#include "DSP/EnvelopeFollower.h"
+#include "DSP/CrossfadeSwitch.h"
+#include "DSP/AudioArena.h"
+#include "DSP/MidSide.h"
 #include "PresetData.h"
+#include "ChainOrder.h"
 
 //==============================================================================
 /**
  *  MacroMorphFX Audio Processor
  *
  *  Signal chain: Input Gain → Filter → Drive → Delay → Reverb → Mix → Output Gain
+ *
+ *  The four modules can run in any order (chainOrder, ChainOrder.h).  Each
+ *  order is a chain function instantiated at compile time (runChain), and
+ *  chainTable_ maps the order index to it — one indirect call per control
+ *  block, no virtual calls or order branches inside the chain.
+ *
+ *  Multichannel buses (5.1, 7.1, 7.1.4, discrete, up to kMaxBusChannels)
+ *  run as channel pairs matched by speaker type (L/R, Ls/Rs, top front
+ *  L/R, ...); centre, LFE, discrete and unmatched channels run alone on the
+ *  mono path, without width, ping-pong or M/S.  Each pair has its own module
+ *  instances (PairChain), while modulation, morph, macros and smoothing are
+ *  computed once per control block (controlBlocks_) and shared by all pairs.
+ *  When rendering offline (isNonRealtime) the pairs can run on a worker pool.
+ *
+ *  In M/S stereo mode the input gain pass also encodes L/R to M/S, each
+ *  module runs on the mid, the side or both (per-scene route, MsRouter),
+ *  and the mix / output gain pass decodes back to L/R (per channel pair).
+ *
+ *  In parallel routing (fxRouting) Delay and Reverb both take the signal
+ *  ahead of whichever of them comes first: the reverb runs on a copy in
+ *  reverbSend, and its return is summed in the mix pass.
+ *
+ *  The module section runs in control blocks of kControlBlockSize samples:
+ *  LFOs, morph, macros, smoothing and module parameters update once per
+ *  control block, independent of the host buffer size.  Control blocks are
+ *  also split at every timestamped performance-param event (ParamEvents.h),
+ *  so MIDI scene / morph / macro changes land on their exact sample (host
+ *  automation applies at the block start).
+ *
+ *  With a processing quantum set (procQuantum), host audio passes through a
+ *  FIFO and the chain always runs on exactly that many samples, so per-block
+ *  overhead and behaviour don't depend on the host buffer size.  This adds
+ *  one quantum of latency, reported to the host.
  */
-class MacroMorphFXProcessor final : public juce::AudioProcessor
+class MacroMorphFXProcessor final : public juce::AudioProcessor,
+                                    private juce::AudioProcessorValueTreeState::Listener,
+                                    private juce::Timer
 {
 public:
     //==============================================================================
@@ -95,40 +140,278 @@ public:
 
 private:
     //==============================================================================
+    /** Control-rate interval in samples (modulation + parameter updates). */
+    static constexpr int kControlBlockSize = 32;
+
+    /** Most performance-param events applied per block: half for queued
+        APVTS changes (the rest wait a block), the remainder for MIDI. */
+    static constexpr int kMaxEventsPerBlock = 256;
+
+    /** Delay crossfade key for free mode (+1 for ping-pong); sync keys are
+        sync * 2 + pingPong, 0..15. */
+    static constexpr int kDelayFreeKey = 16;
+
+    /** Largest processing quantum (procQuantum choices: host, 32, 64). */
+    static constexpr int kMaxQuantum = 64;
+
+    /** Rate the message thread polls the audio thread's mailboxes (latency,
+        MIDI reflection, program changes). */
+    static constexpr int kMessagePollHz = 30;
+
+    /** Widest main bus accepted (22.2 is 24).  Pairs, worker jobs and arena
+        buffers are sized from the actual layout in prepareToPlay; this only
+        bounds memory, which grows with every channel's delay lines. */
+    static constexpr int kMaxBusChannels = 32;
+
+    /** Quantum in samples for a procQuantum choice index (0 = host block size). */
+    static int quantumForChoice (int choice)   { return choice <= 0 ? 0 : 16 << std::min (choice, 2); }
+
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
+    /** One pass of the chain over `buffer` (main bus) — the whole host block,
+        or one quantum from the FIFO. */
+    void processChunk (juce::AudioBuffer<float>& buffer, juce::AudioBuffer<float>& sidechain,
+                       const juce::MidiBuffer& midiMessages, const TransportSnapshot& transport);
+
+    /** This chunk's performance-param events into blockEvents_: queued APVTS
+        changes (after a resync if the queue overflowed), then MIDI.  Program
+        changes and MIDI reflection are left for timerCallback.
+        @returns the number of events */
+    int gatherParamEvents (const juce::MidiBuffer& midiMessages);
+
+    /** Channels one PairChain runs on: a left / right pair of the layout,
+        or one channel on its own (second = -1). */
+    struct ChannelPair
+    {
+        int first = 0, second = -1;
+
+        bool isStereo() const noexcept                 { return second >= 0; }
+        bool fits (int numChannels) const noexcept     { return first < numChannels && second < numChannels; }
+        bool operator== (const ChannelPair& other) const noexcept { return first == other.first && second == other.second; }
+    };
+
+    /** Pairs `layout`'s channels by speaker type: a 7.1 bus is L/R, Ls/Rs,
+        Lrs/Rrs plus C and LFE on their own.  Discrete channels carry no
+        speaker position, so each runs alone. */
+    static std::vector<ChannelPair> pairChannels (const juce::AudioChannelSet& layout, int numChannels);
+
+    /** Module instances for one channel pair (one channel on the mono path). */
+    struct PairChain
+    {
+        /** `spec`: the pair's channels, kControlBlockSize samples at most. */
+        void prepare (const juce::dsp::ProcessSpec& spec);
+        void changeSampleRate (const juce::dsp::ProcessSpec& spec);
+        void assignBuffers (AudioArena& arena, bool freezeLoop);
+        void reset();
+
+        ChannelPair channels;   // bus channels this chain reads and writes
+
+        // DSP modules (Lane A) — in default chain order.  Modules with discrete
+        // scene params sit in a CrossfadeSwitch so those params change click-free.
+        CrossfadeSwitch<FilterModule> filterModule;   // key: filter mode
+        CrossfadeSwitch<DriveModule>  driveModule;    // key: drive curve
+        CrossfadeSwitch<DelayModule>  delayModule;    // key: sync * 2 + ping-pong, or kDelayFreeKey + ping-pong
+        ReverbModule                  reverbModule;
+
+        // M/S routing per module (pass-through in L/R mode)
+        MsRouter filterRoute, driveRoute, delayRoute, reverbRoute;
+    };
+
+    /** Smoothed scene values for one control block, shared by every pair. */
+    struct ControlBlock
+    {
+        int start = 0, length = 0;
+        double ppq = 0.0;
+        SceneParams params;
+    };
+
+    /** Worker-pool job running one channel pair (offline rendering). */
+    class PairJob final : public juce::ThreadPoolJob
+    {
+    public:
+        PairJob (MacroMorphFXProcessor& o, int pairIndex)
+            : juce::ThreadPoolJob ("MacroMorphFX pair"), owner (o), pair (pairIndex) {}
+
+        JobStatus runJob() override;
+
+    private:
+        MacroMorphFXProcessor& owner;
+        const int pair;
+    };
+
+    /** What a module stage needs for one control block. */
+    struct StageContext
+    {
+        PairChain& pair;                      // module instances of this channel pair
+        juce::dsp::AudioBlock<float> block;   // main chain, this control block
+        juce::dsp::AudioBlock<float> send;    // reverbSend, this control block (parallel)
+        const SceneParams& params;            // smoothed scene values
+        DriveAutoGain autoGain;
+        double ppq, bpm;
+        bool midSide, parallel;
+        bool freezeLoop;                      // frozen reverb plays a captured loop
+        bool sendTapped;                      // parallel: send already copied from the chain
+    };
+
+    using ChainFn = void (MacroMorphFXProcessor::*) (StageContext&);
+
+    /** Per-chunk inputs of the module pass (read-only while pairs run). */
+    struct PairPass
+    {
+        juce::dsp::AudioBlock<float> block, send;   // whole chunk, all channels
+        ChainFn chain = nullptr;                    // runChain for the chain order
+        int numControlBlocks = 0;
+        DriveAutoGain autoGain = DriveAutoGain::off;
+        double bpm = 120.0;
+        bool midSide = false, parallel = false, freezeLoop = false;
+    };
+
+    /** Every control block of the chunk through one pair's modules. */
+    void processPair (int pairIndex);
+
+    /** One control block through the modules, in a fixed order (ChainStage indices). */
+    template <int... Stages> void runChain (StageContext& ctx);
+    template <int Stage>     void runStage (StageContext& ctx);
+
+    void processFilterStage (StageContext& ctx);
+    void processDriveStage  (StageContext& ctx);
+    void processDelayStage  (StageContext& ctx);
+    void processReverbStage (StageContext& ctx);
+
+    /** Parallel: copy the chain into the send on the first of Delay / Reverb. */
+    static void tapReverbSend (StageContext& ctx);
+
+    /** A module's M/S route (Both in L/R mode). */
+    static MsRoute routeFor (const StageContext& ctx, int param);
+
+    template <size_t... Orders>
+    static std::array<ChainFn, sizeof... (Orders)> makeChainTable (std::index_sequence<Orders...>);
+
+    /** runChain instantiation per chain order (index = chainOrder). */
+    static const std::array<ChainFn, kNumChainOrders> chainTable_;
+
+    /** Clear the quantum FIFO (quantum change, prepare). */
+    void resetQuantumFifo();
+
+    /** Lay out / assign every audio buffer in the arena (called twice per prepare). */
+    void assignBuffers (AudioArena& arena, const juce::dsp::ProcessSpec& spec);
+
     /** Load preset scene + macro data (no APVTS reset). */
     void loadFactoryPresetData (int index);
 
+    /** Current morph mode / scenes / position from the APVTS (no modulation). */
+    MorphPosition readMorphPosition() const;
+
+    /** Read every performance param from the APVTS. */
+    void readPerfState (PerfState& state) const;
+
+    /** Morph mode / scenes / position from a performance state. */
+    static MorphPosition toMorphPosition (const PerfState& state);
+
+    /** APVTS listener: queue performance-param changes as timestamped events. */
+    void parameterChanged (const juce::String& parameterID, float newValue) override;
+
+    /** Message thread, polled: report a changed processing-quantum latency,
+        load MIDI program changes and reflect MIDI-driven values to the
+        APVTS (the audio thread only sets atomics). */
+    void timerCallback() override;
+
+    // Member layout: four regions, each starting on its own cache line
+    // (alignas (64)), so the editor's timer reading telemetry or editing
+    // configuration doesn't invalidate the lines the audio thread works in.
+    //
+    //   cold       — configuration, written by the message thread, read by audio
+    //   mailboxes  — atomics / queues crossing threads
+    //   hot        — audio-thread-only state, in processing order
+    //   telemetry  — written once per block by audio, polled by the editor
+
+    // ════ Cold: configuration ═════════════════════════════════════════
     // ── Preset tracking ────────────────────────────────────────────────
-    int currentProgram_ = 0;
+    alignas (64) int currentProgram_ = 0;
+    juce::SharedResourcePointer<FactoryPresetBank> factoryPresets_;   // shared by all instances
 
-    // ── Scene + Morph + Macro (Lane D) ─────────────────────────────────
+    // ── Last prepareToPlay spec (fast re-prepare / rate-change path) ───
+    juce::dsp::ProcessSpec preparedSpec_ {};
+    double arenaRate_  = 0.0;     // rate the arena's rate-dependent buffers are sized for
+    bool   isPrepared_ = false;
+    bool   loopReserved_ = false; // arena holds the reverb's frozen-loop buffers (revFreezeLoop)
+
+    // ── Scenes + macro mappings (Lane D; edited from the UI) ──────────
     std::array<SceneParams, kNumScenes> scenes_;
     MacroEngine macroEngine_;
 
-    // DSP modules (Lane A) — in signal chain order
-    FilterModule filterModule;
-    DriveModule  driveModule;
-    DelayModule  delayModule;
-    ReverbModule reverbModule;
+    // ── Offline worker pool: pairs 1.. of a multichannel bus (pair 0 runs on the caller) ─
+    // Created in prepareToPlay; the audio thread only queues the jobs
+    std::unique_ptr<juce::ThreadPool> pairPool_;
+    std::vector<std::unique_ptr<PairJob>> pairJobs_;   // one per pair, [0] unused
+
+    // ════ Mailboxes: cross-thread ═════════════════════════════════════
+    // ── Performance param events (APVTS listener / MIDI → audio) ──────
+    ParamEventQueue paramEvents_;   // head / tail on their own lines
+    alignas (64) std::atomic<bool> perfResync_ { true };   // reload perfState_ from APVTS (start, overflow)
+
+    // ── MIDI / latency → message thread (program change, APVTS reflection) ─
+    std::atomic<int> pendingProgram_ { -1 };
+    std::atomic<int> quantumLatency_ { 0 };
+    std::array<std::atomic<float>, PerfParam::kCount> midiValues_ {};
+    std::array<std::atomic<bool>,  PerfParam::kCount> midiDirty_ {};
+    std::atomic<bool> midiPending_ { false };   // any of the above set; polled by timerCallback
+
+    // ════ Hot: audio thread only ══════════════════════════════════════
+    // ── Performance params (audio-thread state, changed by events) ────
+    alignas (64) PerfState perfState_;
+    std::array<ParamEvent, kMaxEventsPerBlock> blockEvents_;
+
+    // ── Morph (Lane D) ─────────────────────────────────────────────────
+    VectorMorph vectorMorph_;
+
+    // ── Host transport (playhead read once per block) ─────────────────
+    HostTransport hostTransport_;
+
+    // ── Processing quantum FIFO ───────────────────────────────────────
+    int quantum_ = 0;                                 // 0 = process host blocks directly
+    std::array<juce::AudioBuffer<float>, 2> quantumFifo_;   // [in] being filled, [out] being played
+    int quantumFifoIn_ = 0;
+    int quantumPos_    = 0;
+    juce::AudioBuffer<float> quantumSidechain_;
+    juce::MidiBuffer quantumMidi_;
+
+    // ── Modulation sources (evaluated at control rate) ─────────────────
+    LfoBank lfoBank_;
+    EnvelopeFollower envFollower_;   // main input + sidechain
 
-    // Gain helpers
-    juce::dsp::Gain<float> inputGain;
-    juce::dsp::Gain<float> outputGain;
+    // ── Parameter smoothing (per SPEC: cutoff 20ms, fb 50ms, etc.) ───
+    std::array<juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>,
+               SceneParam::kCount> smoothScene_;
+
+    // Gain helpers (20 ms ramps; M/S encode / decode ride on these passes)
+    juce::SmoothedValue<float> inputGain;
+    juce::SmoothedValue<float> outputGain;
 
     // Dry buffer for dry/wet mix
     juce::AudioBuffer<float> dryBuffer;
 
-    // ── Parameter smoothing (per SPEC: cutoff 20ms, fb 50ms, etc.) ───
-    std::array<juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>,
-               SceneParam::kCount> smoothScene_;
+    // Parallel routing: post-drive copy the reverb runs on, summed in the mix
+    juce::AudioBuffer<float> reverbSend;
+
+    // Control-rate values of the current chunk (sized in prepareToPlay)
+    std::vector<ControlBlock> controlBlocks_;
+    PairPass pairPass_;
+
+    // DSP modules, one chain per channel pair (sized in prepareToPlay)
+    std::vector<std::unique_ptr<PairChain>> pairs_;
 
     // ── Bypass crossfade (10ms per SPEC) ──────────────────────────────
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> bypassSmooth_;
 
+    // Backing memory for the dry / send buffers, quantum FIFO and module delay lines
+    AudioArena arena_;
+
+    // ════ Telemetry: audio → editor ═══════════════════════════════════
     // ── Last computed params (for UI display, written on audio thread) ─
-    SceneParams lastComputedParams_;
+    // Last member: the class is 64-byte aligned, so the padding after it
+    // keeps the next heap object off these lines too.
+    alignas (64) SceneParams lastComputedParams_;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MacroMorphFXProcessor)
 };
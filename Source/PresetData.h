@@ -5,26 +5,33 @@
  *  MacroMorphFX — Factory Preset Definitions
  * ============================================================================
  *
- *  Defines 8 factory presets, each containing:
+ *  Defines 9 factory presets, each containing:
  *    - 8 scene snapshots (SceneParams)
  *    - 4 macro configurations (targets + amounts)
+ *    - a module chain order (index into kChainOrders, ChainOrder.h)
  *
  *  The "Init" preset uses the same scenes as the original initDefaultScenes().
  *  Other presets transform the base scenes to create different characters.
  *
+ *  The presets are built once per process into a FactoryPresetBank shared
+ *  by every plugin instance (juce::SharedResourcePointer).
+ *
  *  See docs/SPEC.md — "Presets" section.
  * ============================================================================
  */
 
 #include "SceneData.h"
 #include "MacroEngine.h"
+#include "DSP/DriveModule.h"
+#include "DSP/ReverbModule.h"
+#include "ChainOrder.h"
 #include <array>
 #include <algorithm>
 #include <cmath>
 
 // ─── Constants ─────────────────────────────────────────────────────────────
 
-static constexpr int kNumFactoryPresets = 8;
+static constexpr int kNumFactoryPresets = 9;
 
 static constexpr const char* kFactoryPresetNames[kNumFactoryPresets] = {
     "Init",
@@ -34,7 +41,8 @@ static constexpr const char* kFactoryPresetNames[kNumFactoryPresets] = {
     "Shimmer Pad",
     "Dub Station",
     "Distortion Box",
-    "Wide Stereo"
+    "Wide Stereo",
+    "Crushed Echoes"
 };
 
 // ─── Factory macro config struct ───────────────────────────────────────────
@@ -50,6 +58,7 @@ struct FactoryPreset
 {
     std::array<SceneParams, kNumScenes> scenes;
     std::array<FactoryMacroConfig, MacroEngine::kNumMacros> macros;
+    int chainOrder = 0;   // Filter → Drive → Delay → Reverb
 };
 
 // ─── Helper: transform all scenes for a given parameter ────────────────────
@@ -166,7 +175,7 @@ inline std::array<FactoryMacroConfig, MacroEngine::kNumMacros> makeDefaultMacros
     return m;
 }
 
-// ─── Build all 8 factory presets ────────────────────────────────────────────
+// ─── Build all 9 factory presets ────────────────────────────────────────────
 
 inline std::array<FactoryPreset, kNumFactoryPresets> createFactoryPresets()
 {
@@ -185,6 +194,9 @@ inline std::array<FactoryPreset, kNumFactoryPresets> createFactoryPresets()
     transformScenes (p[1].scenes, SceneParam::revDamp,    0.15f);
     transformScenes (p[1].scenes, SceneParam::driveTone,  0.f,  0.5f);
     transformScenes (p[1].scenes, SceneParam::delayTone,  0.f,  0.5f);
+    transformScenes (p[1].scenes, SceneParam::revEarly,   0.3f);
+    for (auto& s : p[1].scenes)
+        s.values[SceneParam::revRoom] = static_cast<float> (RoomShape::church);
     p[1].macros = defaultMacros;
     p[1].macros[0].numTargets = 2;
     p[1].macros[0].targets[0] = { SceneParam::filtCutoff, 0.8f };
@@ -209,6 +221,15 @@ inline std::array<FactoryPreset, kNumFactoryPresets> createFactoryPresets()
     transformScenes (p[3].scenes, SceneParam::filtCutoff, 0.f, 0.5f);
     transformScenes (p[3].scenes, SceneParam::driveAmt,   0.25f);
     transformScenes (p[3].scenes, SceneParam::filtReso,   0.1f);
+    for (size_t i = 0; i < p[3].scenes.size(); ++i)
+    {
+        // Real bit / rate reduction, grittier towards the later scenes
+        auto& s = p[3].scenes[i];
+        s.values[SceneParam::driveCurve]  = static_cast<float> (DriveCurve::crush);
+        s.values[SceneParam::crushBits]   = 10.0f - 0.75f * static_cast<float> (i);
+        s.values[SceneParam::crushRate]   = 2.0f + static_cast<float> (i);
+        s.values[SceneParam::crushDither] = 1.f;
+    }
     p[3].macros = defaultMacros;
     p[3].macros[1].numTargets = 3;
     p[3].macros[1].targets[0] = { SceneParam::driveAmt,    0.5f };
@@ -222,6 +243,8 @@ inline std::array<FactoryPreset, kNumFactoryPresets> createFactoryPresets()
     transformScenes (p[4].scenes, SceneParam::revDamp,    0.f, 0.3f);
     transformScenes (p[4].scenes, SceneParam::revWidth,   0.2f);
     transformScenes (p[4].scenes, SceneParam::driveAmt,   0.f, 0.3f);
+    transformScenes (p[4].scenes, SceneParam::delayDiffuse, 0.5f);
+    p[4].scenes[7].values[SceneParam::revFreeze] = 1.f;   // scene 8: frozen pad
     p[4].macros = defaultMacros;
     p[4].macros[0].numTargets = 2;
     p[4].macros[0].targets[0] = { SceneParam::filtCutoff, 0.4f };
@@ -232,6 +255,9 @@ inline std::array<FactoryPreset, kNumFactoryPresets> createFactoryPresets()
     transformScenes (p[5].scenes, SceneParam::delayFb,   0.25f);
     transformScenes (p[5].scenes, SceneParam::delayTone, 0.f, 0.4f);
     transformScenes (p[5].scenes, SceneParam::revSize,   0.15f);
+    transformScenes (p[5].scenes, SceneParam::delayWow,  0.25f);
+    transformScenes (p[5].scenes, SceneParam::delayDrift,0.3f);
+    transformScenes (p[5].scenes, SceneParam::delaySat,  0.4f);
     p[5].macros = defaultMacros;
     p[5].macros[2].numTargets = 3;
     p[5].macros[2].targets[0] = { SceneParam::delayFb,    0.3f };
@@ -244,6 +270,15 @@ inline std::array<FactoryPreset, kNumFactoryPresets> createFactoryPresets()
     transformScenes (p[6].scenes, SceneParam::filtCutoff, 0.f, 0.6f);
     transformScenes (p[6].scenes, SceneParam::revSize,    0.f, 0.3f);
     transformScenes (p[6].scenes, SceneParam::delayFb,    0.f, 0.5f);
+    {
+        // A different character per scene
+        static constexpr DriveCurve curves[kNumScenes] = {
+            DriveCurve::tanh, DriveCurve::hard, DriveCurve::tube, DriveCurve::foldback,
+            DriveCurve::sineFold, DriveCurve::hard, DriveCurve::tube, DriveCurve::crush
+        };
+        for (int i = 0; i < kNumScenes; ++i)
+            p[6].scenes[static_cast<size_t> (i)].values[SceneParam::driveCurve] = static_cast<float> (curves[i]);
+    }
     p[6].macros = defaultMacros;
     p[6].macros[1].numTargets = 2;
     p[6].macros[1].targets[0] = { SceneParam::driveAmt,  0.4f };
@@ -265,6 +300,26 @@ inline std::array<FactoryPreset, kNumFactoryPresets> createFactoryPresets()
     p[7].macros[3].targets[1] = { SceneParam::revWidth,    0.3f };
     p[7].macros[3].targets[2] = { SceneParam::revPreDelay, 0.3f };
 
+    // ── 8: Crushed Echoes ───────────────────────────────────────────────
+    // Lo-Fi's scenes with the delay ahead of the drive, so every repeat
+    // runs into the crusher again
+    p[8].scenes = p[3].scenes;
+    transformScenes (p[8].scenes, SceneParam::delayFb, 0.2f);
+    p[8].chainOrder = 2;   // Flt > Dly > Drv > Rev
+    p[8].macros = p[3].macros;
+    p[8].macros[2].numTargets = 2;
+    p[8].macros[2].targets[0] = { SceneParam::delayFb,  0.4f };
+    p[8].macros[2].targets[1] = { SceneParam::crushBits, -0.3f };
+
     return p;
 }
 
+// ─── Shared preset bank ─────────────────────────────────────────────────────
+
+/** All factory presets, built once and shared by every plugin instance
+    through juce::SharedResourcePointer<FactoryPresetBank> (created with the
+    processor on the message thread). */
+struct FactoryPresetBank
+{
+    const std::array<FactoryPreset, kNumFactoryPresets> presets = createFactoryPresets();
+};
@@ -5,11 +5,13 @@
  *  MacroMorphFX — Scene Data
  * ============================================================================
  *
- *  Each scene stores a snapshot of the 14 module parameters (NOT macros,
+ *  Each scene stores a snapshot of the 34 module parameters (NOT macros,
  *  NOT morph, NOT performance params like input/output gain).
  *
  *  The plugin stores 8 scenes per preset.  The morph engine interpolates
- *  between two selected scenes (A and B) based on the morph knob (0..1).
+ *  between two selected scenes (A and B) based on the morph knob (0..1),
+ *  or blends up to all 8 scenes with normalized weights (vector morph,
+ *  see VectorMorph.h).
  *
  *  See docs/SPEC.md — "Scenes" section.
  * ============================================================================
@@ -28,18 +30,38 @@ namespace SceneParam
         filtMode = 0,
         filtCutoff,
         filtReso,
+        filtRoute,
         driveAmt,
         driveTone,
+        driveCurve,
+        crushBits,
+        crushRate,
+        crushDither,
+        driveRoute,
         delaySync,
         delayFb,
         delayTone,
         delayWidth,
         delayPingP,
+        delayMode,
+        delayTime,
+        delayWow,
+        delayFlutter,
+        delayDrift,
+        delaySat,
+        delayDiffuse,
+        delayLevel,
+        delayRoute,
         revSize,
         revDamp,
         revPreDelay,
         revWidth,
-        kCount   // = 14
+        revLevel,
+        revFreeze,
+        revEarly,
+        revRoom,
+        revRoute,
+        kCount   // = 34
     };
 
     /** Metadata for each scene parameter (range, default, discrete flag). */
@@ -49,7 +71,7 @@ namespace SceneParam
         float minVal;
         float maxVal;
         float defaultVal;
-        bool  isDiscrete;        // filtMode, delaySync, delayPingP
+        bool  isDiscrete;        // filtMode, driveCurve, crushDither, delaySync, delayPingP, delayMode, revFreeze, revRoom, *Route
     };
 
     /** Canonical info table — order matches Index enum above. */
@@ -57,17 +79,37 @@ namespace SceneParam
         { Params::ID::filtMode,    0.f,    2.f,     0.f,    true  },
         { Params::ID::filtCutoff,  20.f,   20000.f, 8000.f, false },
         { Params::ID::filtReso,    0.f,    1.f,     0.2f,   false },
+        { Params::ID::filtRoute,   0.f,    2.f,     0.f,    true  },
         { Params::ID::driveAmt,    0.f,    1.f,     0.f,    false },
         { Params::ID::driveTone,   0.f,    1.f,     0.5f,   false },
+        { Params::ID::driveCurve,  0.f,    5.f,     0.f,    true  },
+        { Params::ID::crushBits,   2.f,    16.f,    16.f,   false },
+        { Params::ID::crushRate,   1.f,    32.f,    1.f,    false },
+        { Params::ID::crushDither, 0.f,    1.f,     0.f,    true  },
+        { Params::ID::driveRoute,  0.f,    2.f,     0.f,    true  },
         { Params::ID::delaySync,   0.f,    7.f,     2.f,    true  },
         { Params::ID::delayFb,     0.f,    0.95f,   0.25f,  false },
         { Params::ID::delayTone,   0.f,    1.f,     0.5f,   false },
         { Params::ID::delayWidth,  0.f,    1.f,     0.7f,   false },
         { Params::ID::delayPingP,  0.f,    1.f,     0.f,    true  },
+        { Params::ID::delayMode,   0.f,    1.f,     0.f,    true  },
+        { Params::ID::delayTime,   1.f,    4000.f,  375.f,  false },
+        { Params::ID::delayWow,    0.f,    1.f,     0.f,    false },
+        { Params::ID::delayFlutter,0.f,    1.f,     0.f,    false },
+        { Params::ID::delayDrift,  0.f,    1.f,     0.f,    false },
+        { Params::ID::delaySat,    0.f,    1.f,     0.f,    false },
+        { Params::ID::delayDiffuse,0.f,    1.f,     0.f,    false },
+        { Params::ID::delayLevel,  0.f,    1.f,     1.f,    false },
+        { Params::ID::delayRoute,  0.f,    2.f,     0.f,    true  },
         { Params::ID::revSize,     0.f,    1.f,     0.35f,  false },
         { Params::ID::revDamp,     0.f,    1.f,     0.5f,   false },
         { Params::ID::revPreDelay, 0.f,    200.f,   10.f,   false },
         { Params::ID::revWidth,    0.f,    1.f,     0.8f,   false },
+        { Params::ID::revLevel,    0.f,    1.f,     1.f,    false },
+        { Params::ID::revFreeze,   0.f,    1.f,     0.f,    true  },
+        { Params::ID::revEarly,    0.f,    1.f,     0.f,    false },
+        { Params::ID::revRoom,     0.f,    3.f,     0.f,    true  },
+        { Params::ID::revRoute,    0.f,    2.f,     0.f,    true  },
     }};
 
 } // namespace SceneParam
@@ -88,33 +130,59 @@ struct SceneParams
     }
 
     /**
-     *  Morph between two scenes.
+     *  Blend N scenes with normalized weights (weights × scenes matrix product).
      *
-     *  SPEC rules:
-     *    - Continuous params: linear interpolation
-     *    - Discrete params (mode/sync/pingpong): A if morph < 0.5, else B
+     *    - Continuous params: sum of weight[n] * scene[n]
+     *    - Discrete params: taken from the highest-weight scene
+     *                       (ties go to the later scene)
+     *
+     *  The inner loop runs over the fixed-size value array with no branches,
+     *  so the compiler vectorizes it; scenes with zero weight are skipped.
+     *
+     *  @param scenes     contiguous array of numScenes scenes
+     *  @param weights    one weight per scene, expected to sum to 1
      */
-    static SceneParams morph (const SceneParams& a, const SceneParams& b, float t)
+    static SceneParams blend (const SceneParams* scenes, const float* weights, int numScenes)
     {
-        SceneParams result;
+        SceneParams result;   // zero-initialised accumulator
+        int dominant = 0;
 
-        for (int i = 0; i < SceneParam::kCount; ++i)
+        for (int n = 0; n < numScenes; ++n)
         {
-            const auto& inf = SceneParam::info[static_cast<size_t> (i)];
+            const float w = weights[n];
+
+            if (w >= weights[dominant])
+                dominant = n;
 
-            if (inf.isDiscrete)
-            {
-                result.values[i] = (t < 0.5f) ? a.values[i] : b.values[i];
-            }
-            else
-            {
-                result.values[i] = a.values[i] + t * (b.values[i] - a.values[i]);
-            }
+            if (w == 0.0f)
+                continue;
+
+            const float* src = scenes[n].values;
+            for (int i = 0; i < SceneParam::kCount; ++i)
+                result.values[i] += w * src[i];
         }
 
+        for (int i = 0; i < SceneParam::kCount; ++i)
+            if (SceneParam::info[static_cast<size_t> (i)].isDiscrete)
+                result.values[i] = scenes[dominant].values[i];
+
         return result;
     }
 
+    /**
+     *  Morph between two scenes — the 2-scene case of blend().
+     *
+     *  SPEC rules:
+     *    - Continuous params: linear interpolation
+     *    - Discrete params (mode/sync/pingpong): A if morph < 0.5, else B
+     */
+    static SceneParams morph (const SceneParams& a, const SceneParams& b, float t)
+    {
+        const SceneParams pair[2] = { a, b };
+        const float weights[2]    = { 1.0f - t, t };
+        return blend (pair, weights, 2);
+    }
+
     /** Clamp every value to its valid range. */
     void clampToRanges()
     {
@@ -0,0 +1,145 @@
+#pragma once
+
+/**
+ * ============================================================================
+ *  MacroMorphFX — Vector Morph
+ * ============================================================================
+ *
+ *  Turns the morph controls into one normalized weight per scene slot, then
+ *  blends the scenes with SceneParams::blend() (weights × scenes).
+ *
+ *  Modes:
+ *    - A/B:   scene A → scene B along the morph knob (the original 2-scene
+ *             morph, kept as its own special case so A/B tie-breaking is
+ *             unchanged)
+ *    - XY:    scenes A / B / C / D on the corners of an XY pad
+ *             (A bottom-left, B bottom-right, C top-left, D top-right),
+ *             bilinear weights
+ *    - Ring:  scenes 1..N (N = 3..8) evenly spaced on a circle inside the
+ *             XY pad, inverse-distance² weights — the pad centre blends all
+ *             N scenes equally, a point on a scene gives that scene alone
+ *
+ *  Weights are computed once per control block, so X/Y can be modulated by
+ *  the LFOs / envelope followers like morph.
+ *
+ *  Lane D — Scenes/Morph/Macros
+ * ============================================================================
+ */
+
+#include "SceneData.h"
+#include <array>
+#include <algorithm>
+#include <cmath>
+
+// ─── Morph modes ───────────────────────────────────────────────────────────
+
+enum class MorphMode
+{
+    ab = 0,
+    xy,
+    ring,
+    kCount
+};
+
+static constexpr const char* morphModeNames[] = {
+    "A/B", "XY", "Ring"
+};
+
+/** Smallest / largest number of scenes on the ring. */
+static constexpr int kMinRingScenes = 3;
+static constexpr int kMaxRingScenes = kNumScenes;
+
+/** Morph controls for one control block (APVTS values + modulation). */
+struct MorphPosition
+{
+    MorphMode mode = MorphMode::ab;
+    int   scenes[4] = { 0, 1, 2, 3 };   // A, B, C, D slot indices (0..7)
+    float morph = 0.0f;                 // A/B position 0..1
+    float x = 0.5f;                     // XY / Ring position 0..1
+    float y = 0.5f;
+    int   ringScenes = kMaxRingScenes;  // Ring: scenes 1..ringScenes
+};
+
+// ─── Vector morph ──────────────────────────────────────────────────────────
+
+class VectorMorph
+{
+public:
+    VectorMorph()
+    {
+        // Ring positions for every ring size (built here, not on the audio thread)
+        for (int n = kMinRingScenes; n <= kMaxRingScenes; ++n)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                // Scene 1 at the top, then clockwise
+                const double angle = 2.0 * 3.14159265358979323846 * i / n;
+                auto& p = ringPos_[static_cast<size_t> (n - kMinRingScenes)][static_cast<size_t> (i)];
+                p[0] = static_cast<float> (0.5 + 0.5 * std::sin (angle));
+                p[1] = static_cast<float> (0.5 + 0.5 * std::cos (angle));
+            }
+        }
+    }
+
+    /**
+     *  Fill one normalized weight per scene slot for the XY / Ring modes.
+     *  Slots that appear more than once (e.g. A == C) accumulate their weights.
+     */
+    void computeWeights (const MorphPosition& pos, float (&weights)[kNumScenes]) const
+    {
+        std::fill (std::begin (weights), std::end (weights), 0.0f);
+
+        const float x = std::clamp (pos.x, 0.0f, 1.0f);
+        const float y = std::clamp (pos.y, 0.0f, 1.0f);
+
+        if (pos.mode == MorphMode::ring)
+        {
+            const int n = std::clamp (pos.ringScenes, kMinRingScenes, kMaxRingScenes);
+            const auto& points = ringPos_[static_cast<size_t> (n - kMinRingScenes)];
+            float sum = 0.0f;
+
+            for (int i = 0; i < n; ++i)
+            {
+                const float dx = x - points[static_cast<size_t> (i)][0];
+                const float dy = y - points[static_cast<size_t> (i)][1];
+                weights[i] = 1.0f / (dx * dx + dy * dy + 1.0e-4f);
+                sum += weights[i];
+            }
+
+            const float norm = 1.0f / sum;
+            for (int i = 0; i < n; ++i)
+                weights[i] *= norm;
+
+            return;
+        }
+
+        // XY: bilinear corner weights (always sum to 1)
+        const float corner[4] = {
+            (1.0f - x) * (1.0f - y),   // A
+            x * (1.0f - y),            // B
+            (1.0f - x) * y,            // C
+            x * y                      // D
+        };
+
+        for (int c = 0; c < 4; ++c)
+            weights[std::clamp (pos.scenes[c], 0, kNumScenes - 1)] += corner[c];
+    }
+
+    /** Morphed (pre-macro) scene for the given position. */
+    SceneParams process (const std::array<SceneParams, kNumScenes>& scenes,
+                         const MorphPosition& pos) const
+    {
+        if (pos.mode == MorphMode::ab)
+            return SceneParams::morph (scenes[static_cast<size_t> (std::clamp (pos.scenes[0], 0, kNumScenes - 1))],
+                                       scenes[static_cast<size_t> (std::clamp (pos.scenes[1], 0, kNumScenes - 1))],
+                                       std::clamp (pos.morph, 0.0f, 1.0f));
+
+        float weights[kNumScenes];
+        computeWeights (pos, weights);
+        return SceneParams::blend (scenes.data(), weights, kNumScenes);
+    }
+
+private:
+    std::array<std::array<std::array<float, 2>, kMaxRingScenes>,
+               kMaxRingScenes - kMinRingScenes + 1> ringPos_ {};
+};
@@ -0,0 +1,163 @@
+/**
+ * ============================================================================
+ *  MacroMorphFX — Telemetry polling benchmark
+ * ============================================================================
+ *
+ *  Measures what an editor polling the processor costs the audio thread.
+ *  One thread runs processBlock on noise while another reads
+ *  getLastComputedParams() and every getScene() — what the editor's timer
+ *  reads — at a given rate.  Three runs per invocation:
+ *
+ *    idle      no poller (baseline)
+ *    editor    poller at the editor's timer rate (15 Hz)
+ *    stress    poller in a tight loop (worst case for shared cache lines)
+ *
+ *  Each run prints the mean and 99th-percentile processBlock time in ns
+ *  per sample.  To compare member layouts, build this target once against
+ *  the current Source/ and once against a checkout from before the layout
+ *  change (MACROMORPHFX_BENCH_SOURCE_DIR, see CMakeLists.txt) and run both
+ *  on the same machine:
+ *
+ *      git worktree add ../mmfx-old <commit before "[user-068]">
+ *      cmake -S . -B build-bench -DMACROMORPHFX_BUILD_BENCH=ON
+ *      cmake -S . -B build-bench-old -DMACROMORPHFX_BUILD_BENCH=ON \
+ *            -DMACROMORPHFX_BENCH_SOURCE_DIR=../mmfx-old/Source
+ *
+ *  Build Release: the older tree asserts in debug builds on a sidechain bus
+ *  it never declared.
+ *
+ *  Usage: MacroMorphFXBench [seconds per run = 5] [block size = 64]
+ * ============================================================================
+ */
+
+#include "PluginProcessor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr double kSampleRate = 48000.0;
+    constexpr int    kEditorHz   = 15;   // PluginEditor's timer rate
+
+    struct RunResult
+    {
+        double meanNsPerSample = 0.0;
+        double p99NsPerSample  = 0.0;
+        long long polls        = 0;
+    };
+
+    /** Read what the editor reads, so the compiler can't drop the loads. */
+    float pollTelemetry (const MacroMorphFXProcessor& proc)
+    {
+        float sum = 0.0f;
+
+        for (float v : proc.getLastComputedParams().values)
+            sum += v;
+
+        for (int s = 0; s < kNumScenes; ++s)
+            for (float v : proc.getScene (s).values)
+                sum += v;
+
+        return sum;
+    }
+
+    /** pollHz < 0: no poller; 0: tight loop; otherwise polls per second. */
+    RunResult run (MacroMorphFXProcessor& proc, int blockSize, double seconds, int pollHz)
+    {
+        juce::AudioBuffer<float> buffer (2, blockSize);
+        juce::MidiBuffer midi;
+        juce::Random rng (1234);
+
+        std::atomic<bool> stop { false };
+        std::atomic<long long> polls { 0 };
+        std::thread poller;
+
+        if (pollHz >= 0)
+        {
+            poller = std::thread ([&]
+            {
+                volatile float sink = 0.0f;
+                const auto period = std::chrono::microseconds (pollHz > 0 ? 1000000 / pollHz : 0);
+
+                while (! stop.load (std::memory_order_relaxed))
+                {
+                    sink = sink + pollTelemetry (proc);
+                    polls.fetch_add (1, std::memory_order_relaxed);
+
+                    if (pollHz > 0)
+                        std::this_thread::sleep_for (period);
+                }
+            });
+        }
+
+        const auto numBlocks = static_cast<size_t> (seconds * kSampleRate / blockSize);
+        std::vector<double> blockNs;
+        blockNs.reserve (numBlocks);
+
+        for (size_t b = 0; b < numBlocks; ++b)
+        {
+            for (int ch = 0; ch < 2; ++ch)
+                for (int i = 0; i < blockSize; ++i)
+                    buffer.setSample (ch, i, 0.25f * (rng.nextFloat() * 2.0f - 1.0f));
+
+            const auto start = std::chrono::steady_clock::now();
+            proc.processBlock (buffer, midi);
+            const auto end = std::chrono::steady_clock::now();
+
+            blockNs.push_back (std::chrono::duration<double, std::nano> (end - start).count());
+        }
+
+        stop = true;
+        if (poller.joinable())
+            poller.join();
+
+        RunResult result;
+        double total = 0.0;
+        for (double ns : blockNs)
+            total += ns;
+
+        std::sort (blockNs.begin(), blockNs.end());
+        result.meanNsPerSample = total / static_cast<double> (blockNs.size()) / blockSize;
+        result.p99NsPerSample  = blockNs[blockNs.size() * 99 / 100] / blockSize;
+        result.polls           = polls.load();
+        return result;
+    }
+}
+
+int main (int argc, char* argv[])
+{
+    // The processor owns a message-thread timer; it only needs a MessageManager to exist
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    const double seconds   = argc > 1 ? std::max (0.5, std::atof (argv[1])) : 5.0;
+    const int    blockSize = argc > 2 ? std::clamp (std::atoi (argv[2]), 16, 4096) : 64;
+
+    MacroMorphFXProcessor proc;
+    proc.setPlayConfigDetails (2, 2, kSampleRate, blockSize);
+    proc.prepareToPlay (kSampleRate, blockSize);
+
+    // Warm up: fill delay lines and reverb, settle the smoothers
+    run (proc, blockSize, 1.0, -1);
+
+    struct Case { const char* name; int pollHz; };
+    const Case cases[] = { { "idle", -1 }, { "editor", kEditorHz }, { "stress", 0 } };
+
+    std::printf ("block %d, %.1f s per run, sizeof (processor) %zu\n",
+                 blockSize, seconds, sizeof (MacroMorphFXProcessor));
+    std::printf ("%-8s %14s %14s %12s\n", "run", "mean ns/smp", "p99 ns/smp", "polls");
+
+    for (const auto& c : cases)
+    {
+        const auto r = run (proc, blockSize, seconds, c.pollHz);
+        std::printf ("%-8s %14.2f %14.2f %12lld\n", c.name, r.meanNsPerSample, r.p99NsPerSample, r.polls);
+    }
+
+    proc.releaseResources();
+    return 0;
+}
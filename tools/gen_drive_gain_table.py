@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""
+Generate Source/DSP/DriveGainTable.h — drive auto-gain compensation.
+
+For every drive curve and a grid of drive amounts, run reference signals
+through the same curve math as DriveModule.h and measure the RMS gain the
+curve adds.  The table stores the inverse (linear), averaged in dB over the
+reference signals.
+Make-up gain is capped at unity: auto-gain only takes back the loudness the
+curve adds (crush at low bit depths can lose level; that is left alone).
+
+Reference signals (16384 samples each, 48 kHz):
+  - 1 kHz sine at -18 dBFS RMS
+  - Gaussian noise at -18 dBFS RMS
+  - Gaussian noise at -30 dBFS RMS (quiet material)
+
+Keep the curve functions below in sync with DriveModule.h, then run:
+    python3 tools/gen_drive_gain_table.py > Source/DSP/DriveGainTable.h
+"""
+
+import math
+import random
+
+TABLE_SIZE = 33
+NUM_SAMPLES = 16384
+SAMPLE_RATE = 48000.0
+
+
+# ── Curves (mirror DriveModule.h) ────────────────────────────────────────────
+
+def tanh_curve(amount):
+    g = 1.0 + amount * 49.0
+    return lambda x: math.tanh(g * x)
+
+
+def hard_curve(amount):
+    g = 1.0 + amount * 49.0
+    return lambda x: max(-1.0, min(1.0, g * x))
+
+
+def tube_curve(amount):
+    g = 1.0 + amount * 29.0
+    bias = 0.35
+    return lambda x: math.tanh(g * x + bias) - math.tanh(bias)   # DC removed below
+
+
+def fold_curve(amount):
+    g = 1.0 + amount * 9.0
+
+    def f(x):
+        t = (g * x + 1.0) * 0.25
+        t -= math.floor(t)
+        return 1.0 - 4.0 * abs(t - 0.5)
+    return f
+
+
+def sine_fold_curve(amount):
+    g = 1.0 + amount * 7.0
+    return lambda x: math.sin(0.5 * math.pi * g * x)
+
+
+def crush_curve(amount):
+    levels = 2.0 ** (15.0 - amount * 13.0)
+    return lambda x: round(max(-1.0, min(1.0, x)) * levels) / levels   # hold doesn't change RMS
+
+
+CURVES = [
+    ("tanh", tanh_curve),
+    ("hard", hard_curve),
+    ("tube", tube_curve),
+    ("foldback", fold_curve),
+    ("sineFold", sine_fold_curve),
+    ("crush", crush_curve),
+]
+
+
+# ── Reference signals ────────────────────────────────────────────────────────
+
+def db_to_gain(db):
+    return 10.0 ** (db / 20.0)
+
+
+def rms(xs):
+    mean = sum(xs) / len(xs)
+    return math.sqrt(sum((x - mean) ** 2 for x in xs) / len(xs))
+
+
+def reference_signals():
+    rng = random.Random(1234)
+    sine_amp = db_to_gain(-18.0) * math.sqrt(2.0)
+    sine = [sine_amp * math.sin(2.0 * math.pi * 1000.0 * n / SAMPLE_RATE) for n in range(NUM_SAMPLES)]
+    noise = [rng.gauss(0.0, 1.0) for _ in range(NUM_SAMPLES)]
+    return [
+        sine,
+        [db_to_gain(-18.0) * v for v in noise],
+        [db_to_gain(-30.0) * v for v in noise],
+    ]
+
+
+def main():
+    refs = reference_signals()
+    ref_rms = [rms(r) for r in refs]
+
+    rows = []
+    for name, make in CURVES:
+        gains = []
+        for i in range(TABLE_SIZE):
+            amount = i / (TABLE_SIZE - 1)
+            curve = make(amount)
+            db = 0.0
+            for r, r_rms in zip(refs, ref_rms):
+                out_rms = max(rms([curve(x) for x in r]), 1.0e-9)
+                db += 20.0 * math.log10(out_rms / r_rms)
+            db /= len(refs)
+            gains.append(min(1.0, db_to_gain(-db)))
+        rows.append((name, gains))
+
+    print("#pragma once")
+    print()
+    print("#include <algorithm>")
+    print()
+    print("// Generated by tools/gen_drive_gain_table.py — do not edit by hand.")
+    print()
+    print("/**")
+    print(" *  DriveGainTable — Offline-measured auto-gain for each drive curve")
+    print(" *")
+    print(" *  gain[curve][i] is the linear make-up gain that brings the curve's output")
+    print(" *  back to its input RMS at drive amount i / (kSize - 1), averaged over")
+    print(" *  reference signals (sine and noise at -18 dBFS, noise at -30 dBFS).")
+    print(" *  Capped at unity — the table only takes back loudness a curve adds.")
+    print(" *")
+    print(" *  Lane A — DSP modules (Source/DSP/*)")
+    print(" */")
+    print("namespace DriveGainTable")
+    print("{")
+    print(f"    static constexpr int kSize = {TABLE_SIZE};")
+    print()
+    print(f"    static constexpr float gain[{len(CURVES)}][kSize] = {{")
+    for name, gains in rows:
+        print(f"        {{   // {name}")
+        for k in range(0, TABLE_SIZE, 8):
+            chunk = ", ".join(f"{g:.5f}f" for g in gains[k:k + 8])
+            print(f"            {chunk},")
+        print("        },")
+    print("    };")
+    print()
+    print("    /** Linear-interpolated make-up gain for a curve index and drive amount 0..1. */")
+    print("    inline float lookup (int curve, float amount01)")
+    print("    {")
+    print("        const float pos = std::clamp (amount01, 0.0f, 1.0f) * static_cast<float> (kSize - 1);")
+    print("        const int   i0  = std::min (static_cast<int> (pos), kSize - 2);")
+    print("        const float t   = pos - static_cast<float> (i0);")
+    print("        const auto& row = gain[curve];")
+    print("        return row[i0] + t * (row[i0 + 1] - row[i0]);")
+    print("    }")
+    print("}")
+
+
+if __name__ == "__main__":
+    main()